@@ -30,6 +30,18 @@
 *           $(GUILAYOUT_FUNCTION_INITIALIZE_H)
 *           $(GUILAYOUT_FUNCTION_DRAWING_H)
 *
+*       > Layout table Header file (.h) data generation variables (data-driven, loop-based drawing):
+*           $(GUILAYOUT_TABLE_STRUCT_TYPE)
+*           $(GUILAYOUT_TABLE_DATA)
+*           $(GUILAYOUT_TABLE_FUNCTION_INITIALIZE)
+*           $(GUILAYOUT_TABLE_FUNCTION_DRAWING)
+*
+*       > Layout constexpr C++ header file (.hpp) data generation variables (C++20, compile-time controls data):
+*           $(GUILAYOUT_CONSTEXPR_DATA)
+*           $(GUILAYOUT_CONSTEXPR_STATE)
+*           $(GUILAYOUT_CONSTEXPR_CONSTRUCTOR)
+*           $(GUILAYOUT_CONSTEXPR_FUNCTION_DRAWING)
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2018-2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
@@ -122,7 +134,7 @@ int main()\n\
 \n\
     // De-Initialization\n\
     //--------------------------------------------------------------------------------------\n\
-    CloseWindow();        // Close window and OpenGL context\n\
+    $(GUILAYOUT_DEINITIALIZATION_C)CloseWindow();        // Close window and OpenGL context\n\
     //--------------------------------------------------------------------------------------\n\
 \n\
     return 0;\n\
@@ -223,3 +235,136 @@ $(GUILAYOUT_FUNCTION_DRAWING_H)\n\
 \n\
 #endif // GUI_$(GUILAYOUT_NAME_UPPERCASE)_IMPLEMENTATION\n\
 ";
+
+// Header-only table code file template
+// NOTE: Controls data is exported as static const arrays and drawn in a loop,
+// generated code size is roughly constant per control (buttons functions not supported)
+static const char *guiTemplateTable = "\
+/*******************************************************************************************\n\
+*\n\
+*   $(GUILAYOUT_NAME_PASCALCASE) v$(GUILAYOUT_VERSION) - $(GUILAYOUT_DESCRIPTION)\n\
+*\n\
+*   MODULE USAGE:\n\
+*       #define GUI_$(GUILAYOUT_NAME_UPPERCASE)_IMPLEMENTATION\n\
+*       #include \"gui_$(GUILAYOUT_NAME).h\"\n\
+*\n\
+*       INIT: Gui$(GUILAYOUT_NAME_PASCALCASE)State state = InitGui$(GUILAYOUT_NAME_PASCALCASE)();\n\
+*       DRAW: Gui$(GUILAYOUT_NAME_PASCALCASE)(&state);\n\
+*\n\
+*   NOTE: Controls state is stored in state.controls[] array, in drawing order\n\
+*\n\
+*   LICENSE: Propietary License\n\
+*\n\
+*   Copyright (c) 2022 $(GUILAYOUT_COMPANY). All Rights Reserved.\n\
+*\n\
+*   Unauthorized copying of this file, via any medium is strictly prohibited\n\
+*   This project is proprietary and confidential unless the owner allows\n\
+*   usage in any other form by expresely written permission.\n\
+*\n\
+**********************************************************************************************/\n\
+\n\
+#include \"raylib.h\"\n\
+\n\
+// WARNING: raygui implementation is expected to be defined before including this header\n\
+#undef RAYGUI_IMPLEMENTATION\n\
+#include \"raygui.h\"\n\
+\n\
+#include <string.h>     // Required for: strncpy()\n\
+\n\
+#ifndef GUI_$(GUILAYOUT_NAME_UPPERCASE)_H\n\
+#define GUI_$(GUILAYOUT_NAME_UPPERCASE)_H\n\
+\n\
+$(GUILAYOUT_TABLE_STRUCT_TYPE)\n\
+\n\
+#ifdef __cplusplus\n\
+extern \"C\" {            // Prevents name mangling of functions\n\
+#endif\n\
+\n\
+//----------------------------------------------------------------------------------\n\
+// Module Functions Declaration\n\
+//----------------------------------------------------------------------------------\n\
+Gui$(GUILAYOUT_NAME_PASCALCASE)State InitGui$(GUILAYOUT_NAME_PASCALCASE)(void);\n\
+void Gui$(GUILAYOUT_NAME_PASCALCASE)(Gui$(GUILAYOUT_NAME_PASCALCASE)State *state);\n\
+\n\
+#ifdef __cplusplus\n\
+}\n\
+#endif\n\
+\n\
+#endif // GUI_$(GUILAYOUT_NAME_UPPERCASE)_H\n\
+\n\
+/***********************************************************************************\n\
+*\n\
+*   GUI_$(GUILAYOUT_NAME_UPPERCASE) IMPLEMENTATION\n\
+*\n\
+************************************************************************************/\n\
+#if defined(GUI_$(GUILAYOUT_NAME_UPPERCASE)_IMPLEMENTATION)\n\
+\n\
+#include \"raygui.h\"\n\
+\n\
+//----------------------------------------------------------------------------------\n\
+// Global Variables Definition\n\
+//----------------------------------------------------------------------------------\n\
+$(GUILAYOUT_TABLE_DATA)\n\
+\n\
+//----------------------------------------------------------------------------------\n\
+// Module Functions Definition\n\
+//----------------------------------------------------------------------------------\n\
+$(GUILAYOUT_TABLE_FUNCTION_INITIALIZE)\n\
+\n\
+$(GUILAYOUT_TABLE_FUNCTION_DRAWING)\n\
+\n\
+#endif // GUI_$(GUILAYOUT_NAME_UPPERCASE)_IMPLEMENTATION\n\
+";
+
+// Header-only constexpr C++ code file template (requires C++20)
+// NOTE: Controls data is exported as static constexpr arrays and drawing code is expanded
+// per control at compile time, anchors position is the only runtime input
+static const char *guiTemplateConstexpr = "\
+/*******************************************************************************************\n\
+*\n\
+*   $(GUILAYOUT_NAME_PASCALCASE) v$(GUILAYOUT_VERSION) - $(GUILAYOUT_DESCRIPTION)\n\
+*\n\
+*   MODULE USAGE:\n\
+*       #include \"gui_$(GUILAYOUT_NAME).hpp\"\n\
+*\n\
+*       INIT: Gui$(GUILAYOUT_NAME_PASCALCASE)Layout layout;\n\
+*       DRAW: layout.Draw();\n\
+*\n\
+*   NOTE: Requires C++20, controls state is stored in layout.controls[] array, in drawing order\n\
+*\n\
+*   LICENSE: Propietary License\n\
+*\n\
+*   Copyright (c) 2022 $(GUILAYOUT_COMPANY). All Rights Reserved.\n\
+*\n\
+*   Unauthorized copying of this file, via any medium is strictly prohibited\n\
+*   This project is proprietary and confidential unless the owner allows\n\
+*   usage in any other form by expresely written permission.\n\
+*\n\
+**********************************************************************************************/\n\
+\n\
+#include \"raylib.h\"\n\
+\n\
+// WARNING: raygui implementation is expected to be defined before including this header\n\
+#undef RAYGUI_IMPLEMENTATION\n\
+#include \"raygui.h\"\n\
+\n\
+#include <array>        // Required for: std::array\n\
+#include <cstddef>      // Required for: std::size_t\n\
+#include <utility>      // Required for: std::index_sequence, std::make_index_sequence\n\
+\n\
+#ifndef GUI_$(GUILAYOUT_NAME_UPPERCASE)_HPP\n\
+#define GUI_$(GUILAYOUT_NAME_UPPERCASE)_HPP\n\
+\n\
+struct Gui$(GUILAYOUT_NAME_PASCALCASE)Layout\n\
+{\n\
+    $(GUILAYOUT_CONSTEXPR_DATA)\n\
+\n\
+    $(GUILAYOUT_CONSTEXPR_STATE)\n\
+\n\
+    $(GUILAYOUT_CONSTEXPR_CONSTRUCTOR)\n\
+\n\
+    $(GUILAYOUT_CONSTEXPR_FUNCTION_DRAWING)\n\
+};\n\
+\n\
+#endif // GUI_$(GUILAYOUT_NAME_UPPERCASE)_HPP\n\
+";
@@ -20,6 +20,7 @@
 *           $(GUILAYOUT_FUNCTION_DEFINITION_C)
 *           $(GUILAYOUT_INITIALIZATION_C)
 *           $(GUILAYOUT_DRAWING_C)
+*           $(GUILAYOUT_DEINITIALIZATION_C)
 *
 *       > Layout Header file (.h) data generation variables:
 *           $(GUILAYOUT_STRUCT_TYPE)
@@ -27,7 +28,24 @@
 *           $(GUILAYOUT_FUNCTION_INITIALIZE_H)
 *           $(GUILAYOUT_FUNCTION_DRAWING_H)
 *
+*       > Layout table Header file (.h) data generation variables (data-driven, loop-based drawing):
+*           $(GUILAYOUT_TABLE_STRUCT_TYPE)
+*           $(GUILAYOUT_TABLE_DATA)
+*           $(GUILAYOUT_TABLE_FUNCTION_INITIALIZE)
+*           $(GUILAYOUT_TABLE_FUNCTION_DRAWING)
+*
+*       > Layout constexpr C++ header file (.hpp) data generation variables (C++20, compile-time controls data):
+*           $(GUILAYOUT_CONSTEXPR_DATA)
+*           $(GUILAYOUT_CONSTEXPR_STATE)
+*           $(GUILAYOUT_CONSTEXPR_CONSTRUCTOR)
+*           $(GUILAYOUT_CONSTEXPR_FUNCTION_DRAWING)
+*
+*       > User-defined variables: $(KEY), defined with SetCodeVariable() (command-line: -D KEY=VALUE)
+*
 *   NOTE: Code generated requires raygui 3.5-dev
+*   NOTE: Code generation does not modify the layout and it's reentrant (no static buffers used),
+*   templates must be loaded and user variables defined before generating code from multiple threads
+*   NOTE: Code could be generated into memory (string), into a fixed buffer or streamed into a sink (i.e. file)
 *
 *   LICENSE: zlib/libpng
 *
@@ -50,6 +68,10 @@
 *
 **********************************************************************************************/
 
+// NOTE: Code generation requires layout module globals and functions (controls names, strings)
+#if defined(CODEGEN_IMPLEMENTATION) && !defined(RGUILAYOUT_IMPLEMENTATION)
+    #define RGUILAYOUT_IMPLEMENTATION
+#endif
 #include "rguilayout.h"
 
 #ifndef CODEGEN_H
@@ -59,10 +81,58 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Code template token type
+typedef enum {
+    CODE_TOKEN_TEXT = 0,            // Template literal text
+    CODE_TOKEN_VARIABLE             // Template variable: $(VARIABLE_NAME)
+} GuiCodeTokenType;
+
+// Code template token
+// NOTE: Token text references template text, for variables it's the variable name
+typedef struct {
+    int type;                       // Token type (GuiCodeTokenType)
+    int offset;                     // Token text offset in template text
+    int length;                     // Token text length
+    int tabs;                       // Token indentation level (variables only)
+    int variable;                   // Token variable index in variables registry (-1 if unknown)
+} GuiCodeToken;
+
+// Code template type (compiled)
+// NOTE: Template text is not copied, it must be kept alive while template is used
+typedef struct {
+    const char *text;               // Template text
+    GuiCodeToken *tokens;           // Template tokens
+    int tokenCount;                 // Template tokens count
+    int unknownCount;               // Template unknown variables count
+} GuiCodeTemplate;
+
+// Code sink writer function, returns false on write error
+typedef bool (*GuiCodeSinkWriter)(void *userData, const char *text, int length);
+
+// Code sink (streamed code generation)
+// NOTE: Code is written in chunks as generated, only last chunk is kept in memory
+typedef struct {
+    GuiCodeSinkWriter write;        // Sink writer function
+    void *userData;                 // Sink writer user data (i.e. FILE *)
+} GuiCodeSink;
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
-char *GenLayoutCode(const char *buffer, GuiLayout *layout, Vector2 offset, GuiLayoutConfig config);
+GuiCodeTemplate LoadCodeTemplate(const char *text);             // Load code template (compile template text into tokens)
+void UnloadCodeTemplate(GuiCodeTemplate codeTemplate);          // Unload code template
+bool SetCodeVariable(const char *name, const char *value);      // Set user-defined template variable value (built-in variables can not be redefined)
+void UnloadCodeVariables(void);                                 // Unload user-defined template variables
+
+char *GenLayoutCode(const char *buffer, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config);                 // Generate layout code string from template text
+char *GenLayoutCodeTemplate(const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config); // Generate layout code string from compiled template
+int GenLayoutCodeToBuffer(const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config, char *buffer, int bufferSize); // Generate layout code string from compiled template into provided buffer
+bool GenLayoutCodeToSink(const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config, GuiCodeSink sink); // Generate layout code from compiled template into sink (streamed), returns false on write error
+bool WriteCodeSinkFile(void *file, const char *text, int length);   // Code sink writer for files (user data: FILE *)
 
 #ifdef __cplusplus
 }
@@ -77,178 +147,729 @@ char *GenLayoutCode(const char *buffer, GuiLayout *layout, Vector2 offset, GuiLa
 ************************************************************************************/
 #if defined(CODEGEN_IMPLEMENTATION)
 
-#define TABAPPEND(x, y, z)          { for (int t = 0; t < z; t++) TextAppend(x, "    ", y); }
-#define ENDLINEAPPEND(x, y)         TextAppend(x, "\n", y);
+#include <stdio.h>          // Required for: vsnprintf(), snprintf(), fwrite()
+#include <stdarg.h>         // Required for: va_list, va_start(), va_end(), va_copy()
+#include <ctype.h>          // Required for: toupper(), tolower(), isxdigit()
+#include <string.h>         // Required for: strlen(), strcpy(), strncpy(), strncmp(), memcpy(), memmove(), memset()
+
+#define CODE_BUILDER_INITIAL_CAPACITY   4096    // Initial capacity of code builder (grows on demand)
+#define CODE_SINK_FLUSH_SIZE           65536    // Code builder size to flush code to sink (streamed code generation)
+#define CODE_SINK_KEEP_SIZE              256    // Code builder last characters kept on flush (required to remove characters)
+#define MAX_VARIABLE_NAME_SIZE            64    // Maximum length of template variable name
+#define MAX_CODE_NAME_SIZE               256    // Maximum size of code names texts (layout, controls, functions)
+#define MAX_CODE_REC_SIZE                512    // Maximum size of code rectangles and parameters texts
+#define STATIC_CACHE_MARGIN               16    // Static controls cache render texture margin (drawing out of bounds)
+
+#define TABAPPEND(x, z)             CodeAppendTabs(x, z);
+#define ENDLINEAPPEND(x)            CodeAppendLength(x, "\n", 1);
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Code string builder
+// NOTE: Text is always null-terminated, capacity grows on demand (amortized)
+// In case of fixed (caller provided) text buffer, text is truncated but length keeps counting
+// In case of sink, text is flushed to sink when flush size is reached (bounded memory)
+typedef struct {
+    char *text;                     // Code text
+    int length;                     // Code text length (not including terminator)
+    int capacity;                   // Code text allocated capacity
+    bool fixed;                     // Code text buffer is fixed (not owned, never grows)
+    GuiCodeSink sink;               // Code sink (streamed), no sink writer means code is kept in memory
+    bool sinkError;                 // Code sink write failed
+} CodeBuilder;
+
+// Code template variable writer function
+typedef void (*CodeVariableWriter)(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+
+// Code template variable
+typedef struct {
+    char name[MAX_VARIABLE_NAME_SIZE + 1]; // Variable name
+    CodeVariableWriter writer;      // Variable writer (built-in variables)
+    char *value;                    // Variable value (user-defined variables)
+} CodeVariable;
+
+// Code template variables registry
+// NOTE: Variables are looked up by name on a hash table (FNV-1a hash, linear probing)
+typedef struct {
+    CodeVariable *variables;        // Variables array
+    int count;                      // Variables count
+    int capacity;                   // Variables array allocated capacity
+    int *table;                     // Variables hash table, variables indices + 1 (0 means empty slot)
+    int tableCapacity;              // Variables hash table capacity (power of two)
+} CodeVariableRegistry;
 
 //----------------------------------------------------------------------------------
 // Global variables definition
 //----------------------------------------------------------------------------------
-//...
+static CodeVariableRegistry codeVariables = { 0 };  // Template variables registry: built-in and user-defined
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 
+// Code builder functions
+static void CodeReserve(CodeBuilder *code, int length);                 // Reserve code builder space for additional length
+static void CodeAppendLength(CodeBuilder *code, const char *text, int length); // Append text of given length to code
+static void CodeAppend(CodeBuilder *code, const char *text);            // Append text to code
+static void CodeAppendFormat(CodeBuilder *code, const char *format, ...); // Append formatted text to code
+static void CodeAppendTabs(CodeBuilder *code, int tabs);                // Append tabs (4 spaces) to code
+static void CodeAppendEscaped(CodeBuilder *code, const char *text);     // Append text escaped as C string literal content
+static void CodeRemove(CodeBuilder *code, int length);                  // Remove last characters from code
+static void CodeFlush(CodeBuilder *code, int keep);                     // Flush code to sink, last characters kept in builder
+
+// Template variables registry functions
+static void WriteLayoutCode(CodeBuilder *code, const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config); // Write layout code from compiled template tokens
+static void InitCodeVariables(void);                                    // Init template variables registry with built-in variables
+static int AddCodeVariable(const char *name, CodeVariableWriter writer, const char *value); // Add variable to registry, returns variable index
+static int FindCodeVariable(const char *name, int length);              // Find variable in registry, returns variable index (-1 if not found)
+static unsigned int GetCodeVariableHash(const char *name, int length);  // Get variable name hash (FNV-1a)
+
+// Template built-in variables writting functions
+static void WriteLayoutName(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteLayoutNameUppercase(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteLayoutNameLowercase(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteLayoutNamePascalcase(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteLayoutVersion(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteLayoutDescription(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteLayoutCompany(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteWindowWidth(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteWindowHeight(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+
 // .C Writting code functions (.c)
-static void WriteFunctionsDeclarationC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteInitializationC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteDrawingC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteFunctionsDefinitionC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
+static void WriteFunctionsDeclarationC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteInitializationC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteDrawingC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteDeinitializationC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteFunctionsDefinitionC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
 
 // .H Writting code functions (.h)
-static void WriteStruct(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteFunctionsDeclarationH(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteFunctionInitializeH(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteFunctionDrawingH(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
+static void WriteStruct(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteFunctionsDeclarationH(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteFunctionInitializeH(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteFunctionDrawingH(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+
+// Table writting code functions (.h)
+static void WriteTableStruct(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteTableData(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteTableFunctionInitialize(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteTableFunctionDrawing(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteTableValues(CodeBuilder *code, const char *type, const char *layoutName, const char *layoutNameUpper, const char *field, const int *values, int valueCount, int tabs);
+static int GetTableTextsCount(const GuiLayout *layout);                 // Get table editable texts count (TextBox controls)
+
+// Constexpr C++ writting code functions (.hpp)
+static void WriteConstexprData(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteConstexprState(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteConstexprConstructor(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteConstexprFunctionDrawing(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
 
 // Generic writting code functions (.c/.h)
-static void WriteRectangleVariables(char *toolstr, int *pos, GuiLayoutControl control, bool exportAnchors, bool fullComments, const char *preText, int tabs, bool exportH);
-static void WriteAnchors(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, bool define, bool initialize, const char *preText, int tabs);
-static void WriteConstText(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs);
-static void WriteControlsVariables(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, bool define, bool initialize, const char *preText, int tabs);
-static void WriteControlsDrawing(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, const char *preText, int tabs);
-static void WriteControlDraw(char *toolstr, int *pos, int index, GuiLayoutControl control, GuiLayoutConfig config, const char *preText);
+static void WriteRectangleVariables(CodeBuilder *code, const GuiLayout *layout, int index, Vector2 offset, bool exportAnchors, bool fullComments, const char *preText, int tabs, bool exportH);
+static void WriteAnchors(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, bool define, bool initialize, const char *preText, int tabs);
+static void WriteConstText(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs);
+static void WriteControlsVariables(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, bool define, bool initialize, const char *preText, int tabs);
+static void WriteControlsDrawing(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const char *preText, int tabs);
+static void WriteControlDraw(CodeBuilder *code, const GuiLayout *layout, int index, GuiLayoutControl control, GuiLayoutConfig config, Vector2 offset, const char *preText);
+static void WriteStaticControlsVariables(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, bool initialize, int tabs);
+static void WriteStaticControlsRendering(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const int *order, const int *group, int groupCount, const char *preText, int tabs);
+static void WriteStaticControlsBlit(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const int *order, const int *group, int groupIndex, const char *preText);
 
 // Get controls specific texts functions
-static char *GetControlRectangleText(int index, GuiLayoutControl control, bool defineRecs, bool exportAnchors,  const char *preText);
-static char *GetScrollPanelContainerRecText(int index, GuiLayoutControl control, bool defineRecs, bool exportAnchors, const char *preText);
-static char *GetControlTextParam(GuiLayoutControl control, bool defineText);
-static char *GetControlNameParam(char *controlName, const char *preText);
+// NOTE: Texts are written into provided buffers: MAX_CODE_REC_SIZE (rectangles, texts) or MAX_CODE_NAME_SIZE (names)
+static void GetControlsDrawOrder(const GuiLayout *layout, int *order, int *parent);
+static int GetCodeStaticControls(const GuiLayout *layout, GuiLayoutConfig config, int *group); // Get static controls cache groups (consecutive controls on same anchor), returns groups count
+static void GetStaticGroupOrigin(const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const int *order, const int *group, int groupIndex, const char *preText, char *originX, char *originY, int *width, int *height);
+static int GetCodeAnchorsCount(const GuiLayout *layout);    // Get anchors count used by code (highest used anchor id + 1)
+static GuiAnchorPoint GetCodeAnchor(const GuiLayout *layout, int anchorId, Vector2 offset);
+static GuiLayoutControl GetCodeControl(const GuiLayout *layout, int index, Vector2 offset);
+static char *GetControlRectangleText(const GuiLayout *layout, int index, Vector2 offset, bool defineRecs, bool exportAnchors, const char *preText, char *text);
+static char *GetScrollPanelContainerRecText(const GuiLayout *layout, int index, Vector2 offset, bool defineRecs, bool exportAnchors, const char *preText, char *text);
+static char *GetControlTextParam(const GuiLayout *layout, int index, bool defineText, char *text);
+static char *GetControlNameParam(const char *controlName, const char *preText, char *text);
+static char *CodeTextToUpper(const char *text, char *buffer);
+static char *CodeTextToLower(const char *text, char *buffer);
+static char *CodeTextToPascal(const char *text, char *buffer);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
 
-// Generate layout code string
-// TODO: WARNING: layout is passed as value, probably not a good idea considering the size of the object
-char *GenLayoutCode(const char *buffer, GuiLayout *layout, Vector2 offset, GuiLayoutConfig config)
+// Load code template (compile template text into tokens)
+// NOTE: Template is scanned only once, literal text spans and variables (with indentation) are stored as tokens
+GuiCodeTemplate LoadCodeTemplate(const char *text)
 {
-    #define MAX_CODE_SIZE            1024*1024       // Max code size: 1MB
-    #define MAX_VARIABLE_NAME_SIZE     64
+    GuiCodeTemplate codeTemplate = { 0 };
 
-    if (buffer == NULL) return NULL;
-
-    char *toolstr = (char *)RL_CALLOC(MAX_CODE_SIZE, sizeof(char));
-    const char *substr = NULL;
+    if (text == NULL) return codeTemplate;
 
-    int bufferPos = 0;
-    int codePos = 0;
-    int bufferLen = (int)strlen(buffer);
+    InitCodeVariables();
 
-    // Offset all enabled anchors from reference window and offset
-    for (int a = 1; a < MAX_ANCHOR_POINTS; a++)
-    {
-        if (layout->anchors[a].enabled)
-        {
-            layout->anchors[a].x -= (int)(layout->refWindow.x + offset.x);
-            layout->anchors[a].y -= (int)(layout->refWindow.y + offset.y);
-        }
-    }
+    codeTemplate.text = text;
 
-    // In case of controls with no anchor, offset must be applied to control position
-    // NOTE: refWindow (aka anchor[0]) is already implicit!
-    for (int i = 0; i < layout->controlCount; i++)
-    {
-        if (layout->controls[i].ap->id == 0)
-        {
-            layout->controls[i].rec.x -= offset.x;
-            layout->controls[i].rec.y -= offset.y;
-        }
-    }
+    int textLen = (int)strlen(text);
+    int textPos = 0;
+    int tokenCapacity = 64;
+    codeTemplate.tokens = (GuiCodeToken *)RL_CALLOC(tokenCapacity, sizeof(GuiCodeToken));
 
-    int i = 0;
-    for (i = 0; i < bufferLen; i++)
+    for (int i = 0; i < textLen; i++)
     {
-        if ((buffer[i] == '$') && (buffer[i + 1] == '('))       // Detect variable to be replaced!
+        if ((text[i] == '$') && (text[i + 1] == '('))       // Detect variable to be replaced!
         {
+            // Compute variable indentation, only spaces from line start are considered
             int spaceWidth = 0;
-            for (int j = i-1; j >= 0; j--)
+            for (int j = i - 1; j >= 0; j--)
             {
-                if (buffer[j] == ' ') spaceWidth++;
+                if (text[j] == ' ') spaceWidth++;
                 else
                 {
-                    if (buffer[j] != '\n') spaceWidth = 0;
+                    if (text[j] != '\n') spaceWidth = 0;
                     break;
                 }
             }
-            int tabs = (int)spaceWidth/4;
 
-            substr = TextSubtext(buffer, bufferPos, i - bufferPos);
+            // Look for variable name end
+            int nameLength = -1;
+            for (int j = 0; (j < MAX_VARIABLE_NAME_SIZE) && ((i + 2 + j) < textLen); j++)
+            {
+                if (text[i + 2 + j] == ')')
+                {
+                    nameLength = j;
+                    break;
+                }
+            }
 
-            strcpy(toolstr + codePos, substr);
-            codePos = (int)strlen(toolstr);
+            // Make sure there is space for literal text and variable tokens
+            if ((codeTemplate.tokenCount + 2) > tokenCapacity)
+            {
+                tokenCapacity *= 2;
+                codeTemplate.tokens = (GuiCodeToken *)RL_REALLOC(codeTemplate.tokens, tokenCapacity*sizeof(GuiCodeToken));
+            }
 
-            i += 2;
-            bufferPos = i;
+            // Add literal text up to variable
+            if (i > textPos) codeTemplate.tokens[codeTemplate.tokenCount++] = (GuiCodeToken){ CODE_TOKEN_TEXT, textPos, i - textPos, 0, -1 };
 
-            for (int j = 0; j < MAX_VARIABLE_NAME_SIZE; j++)
+            // Add variable, in case variable is not closed, only "$(" is skipped
+            if (nameLength >= 0)
             {
-                if (buffer[i + j] == ')')
-                {
-                    substr = TextSubtext(buffer, i, j);
-
-                    if (TextIsEqual(substr, "GUILAYOUT_NAME")) TextAppend(toolstr, config.name, &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_UPPERCASE")) TextAppend(toolstr, TextToUpper(config.name), &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_LOWERCASE")) TextAppend(toolstr, TextToLower(config.name), &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_NAME_PASCALCASE")) TextAppend(toolstr, TextToPascal(config.name), &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_VERSION")) TextAppend(toolstr, config.version, &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_DESCRIPTION")) TextAppend(toolstr, config.description, &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_COMPANY")) TextAppend(toolstr, config.company, &codePos);
-                    else if (TextIsEqual(substr, "GUILAYOUT_WINDOW_WIDTH"))
-                    {
-                       if (layout->refWindow.width > 0) TextAppend(toolstr, TextFormat("%i", (int)layout->refWindow.width), &codePos);
-                       else TextAppend(toolstr, TextFormat("%i", 800), &codePos);
-                    }
-                    else if (TextIsEqual(substr, "GUILAYOUT_WINDOW_HEIGHT"))
-                    {
-                       if (layout->refWindow.height > 0) TextAppend(toolstr, TextFormat("%i", (int)layout->refWindow.height), &codePos);
-                       else TextAppend(toolstr, TextFormat("%i", 450), &codePos);
-                    }
-
-                    // C IMPLEMENTATION
-                    else if (TextIsEqual(substr, "GUILAYOUT_FUNCTION_DECLARATION_C")) WriteFunctionsDeclarationC(toolstr, &codePos, layout, config, tabs);
-                    else if (TextIsEqual(substr, "GUILAYOUT_INITIALIZATION_C")) WriteInitializationC(toolstr, &codePos, layout, config, tabs);
-                    else if (TextIsEqual(substr, "GUILAYOUT_DRAWING_C") && layout->controlCount > 0) WriteDrawingC(toolstr, &codePos, layout, config, tabs);
-                    else if (TextIsEqual(substr, "GUILAYOUT_FUNCTION_DEFINITION_C")) WriteFunctionsDefinitionC(toolstr, &codePos, layout, config, tabs);
-
-                    // H IMPLEMENTATION
-                    else if (TextIsEqual(substr, "GUILAYOUT_STRUCT_TYPE")) WriteStruct(toolstr, &codePos, layout, config, tabs);
-                    else if (TextIsEqual(substr, "GUILAYOUT_FUNCTIONS_DECLARATION_H")) WriteFunctionsDeclarationH(toolstr, &codePos, layout, config, tabs);
-                    else if (TextIsEqual(substr, "GUILAYOUT_FUNCTION_INITIALIZE_H")) WriteFunctionInitializeH(toolstr, &codePos, layout, config, tabs);
-                    else if (TextIsEqual(substr, "GUILAYOUT_FUNCTION_DRAWING_H") && layout->controlCount > 0) WriteFunctionDrawingH(toolstr, &codePos, layout, config, tabs);
-
-                    bufferPos += (j + 1);
+                // Resolve variable from registry, unknown variables are reported and generate no code
+                int variable = FindCodeVariable(text + i + 2, nameLength);
 
-                    break;
+                if (variable < 0)
+                {
+                    TraceLog(LOG_WARNING, "CODEGEN: Unknown template variable: $(%.*s)", nameLength, text + i + 2);
+                    codeTemplate.unknownCount++;
                 }
+
+                codeTemplate.tokens[codeTemplate.tokenCount++] = (GuiCodeToken){ CODE_TOKEN_VARIABLE, i + 2, nameLength, spaceWidth/4, variable };
+                textPos = i + 2 + nameLength + 1;
             }
+            else textPos = i + 2;
+
+            i = textPos - 1;
         }
     }
 
-    // Copy remaining text into toolstr
-    strcpy(toolstr + codePos, buffer + bufferPos);
+    // Add remaining literal text
+    if (textPos < textLen)
+    {
+        if ((codeTemplate.tokenCount + 1) > tokenCapacity)
+        {
+            tokenCapacity += 1;
+            codeTemplate.tokens = (GuiCodeToken *)RL_REALLOC(codeTemplate.tokens, tokenCapacity*sizeof(GuiCodeToken));
+        }
 
-    // In case of controls with no anchor, offset must be applied to control position
-    for (int i = 0; i < layout->controlCount; i++)
+        codeTemplate.tokens[codeTemplate.tokenCount++] = (GuiCodeToken){ CODE_TOKEN_TEXT, textPos, textLen - textPos, 0, -1 };
+    }
+
+    return codeTemplate;
+}
+
+// Unload code template
+void UnloadCodeTemplate(GuiCodeTemplate codeTemplate)
+{
+    RL_FREE(codeTemplate.tokens);
+}
+
+// Generate layout code string from template text
+// NOTE: Template is compiled for this generation only, use GenLayoutCodeTemplate() to reuse a compiled template
+char *GenLayoutCode(const char *buffer, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config)
+{
+    if (buffer == NULL) return NULL;
+
+    GuiCodeTemplate codeTemplate = LoadCodeTemplate(buffer);
+    char *toolstr = GenLayoutCodeTemplate(&codeTemplate, layout, offset, config);
+    UnloadCodeTemplate(codeTemplate);
+
+    return toolstr;
+}
+
+// Generate layout code string from compiled template
+// NOTE: Layout is not modified, returned string must be freed by caller (RL_FREE)
+char *GenLayoutCodeTemplate(const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config)
+{
+    if ((codeTemplate == NULL) || (codeTemplate->text == NULL)) return NULL;
+
+    // NOTE: Code builder grows on demand, template size is a good initial estimation
+    CodeBuilder code = { 0 };
+    CodeReserve(&code, (int)strlen(codeTemplate->text) + CODE_BUILDER_INITIAL_CAPACITY);
+
+    WriteLayoutCode(&code, codeTemplate, layout, offset, config);
+
+    // Shrink code text to fit
+    char *toolstr = (char *)RL_REALLOC(code.text, code.length + 1);
+    if (toolstr == NULL) toolstr = code.text;
+
+    return toolstr;
+}
+
+// Generate layout code string from compiled template into provided buffer
+// NOTE: Returns full code length (not including terminator), code is truncated if it does not fit in buffer
+int GenLayoutCodeToBuffer(const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config, char *buffer, int bufferSize)
+{
+    if ((codeTemplate == NULL) || (codeTemplate->text == NULL) || (buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    CodeBuilder code = { 0 };
+    code.text = buffer;
+    code.capacity = bufferSize;
+    code.fixed = true;
+    code.text[0] = '\0';
+
+    WriteLayoutCode(&code, codeTemplate, layout, offset, config);
+
+    return code.length;
+}
+
+// Generate layout code from compiled template into sink (streamed)
+// NOTE: Code is flushed to sink in chunks, memory usage does not depend on code size
+bool GenLayoutCodeToSink(const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config, GuiCodeSink sink)
+{
+    if ((codeTemplate == NULL) || (codeTemplate->text == NULL) || (sink.write == NULL)) return false;
+
+    CodeBuilder code = { 0 };
+    code.sink = sink;
+
+    WriteLayoutCode(&code, codeTemplate, layout, offset, config);
+    CodeFlush(&code, 0);
+
+    RL_FREE(code.text);
+
+    return !code.sinkError;
+}
+
+// Code sink writer for files (user data: FILE *)
+bool WriteCodeSinkFile(void *file, const char *text, int length)
+{
+    return (fwrite(text, 1, length, (FILE *)file) == (size_t)length);
+}
+
+// Set user-defined template variable value (built-in variables can not be redefined)
+// NOTE: Variables must be set before loading the templates using them
+bool SetCodeVariable(const char *name, const char *value)
+{
+    if ((name == NULL) || (value == NULL)) return false;
+
+    int length = (int)strlen(name);
+    if ((length == 0) || (length > MAX_VARIABLE_NAME_SIZE)) return false;
+
+    InitCodeVariables();
+
+    int index = FindCodeVariable(name, length);
+
+    if (index < 0) AddCodeVariable(name, NULL, value);
+    else
+    {
+        CodeVariable *variable = &codeVariables.variables[index];
+
+        if (variable->writer != NULL) return false;
+
+        RL_FREE(variable->value);
+        variable->value = (char *)RL_CALLOC(strlen(value) + 1, 1);
+        strcpy(variable->value, value);
+    }
+
+    return true;
+}
+
+// Unload user-defined template variables
+// NOTE: Registry is reset, built-in variables are registered again on next use
+void UnloadCodeVariables(void)
+{
+    for (int i = 0; i < codeVariables.count; i++) RL_FREE(codeVariables.variables[i].value);
+
+    RL_FREE(codeVariables.variables);
+    RL_FREE(codeVariables.table);
+
+    codeVariables = (CodeVariableRegistry){ 0 };
+}
+
+//----------------------------------------------------------------------------------
+// Template variables registry functions
+//----------------------------------------------------------------------------------
+
+// Write layout code from compiled template tokens
+// NOTE: Positions are computed on writting (layout is not modified), only read access to variables registry
+static void WriteLayoutCode(CodeBuilder *code, const GuiCodeTemplate *codeTemplate, const GuiLayout *layout, Vector2 offset, GuiLayoutConfig config)
+{
+    for (int t = 0; t < codeTemplate->tokenCount; t++)
     {
-        if (layout->controls[i].ap->id == 0)
+        GuiCodeToken token = codeTemplate->tokens[t];
+
+        if (token.type == CODE_TOKEN_TEXT) CodeAppendLength(code, codeTemplate->text + token.offset, token.length);
+        else if ((token.type == CODE_TOKEN_VARIABLE) && (token.variable >= 0) && (token.variable < codeVariables.count))
         {
-            layout->controls[i].rec.x += offset.y;
-            layout->controls[i].rec.y += offset.y;
+            const CodeVariable *variable = &codeVariables.variables[token.variable];
+
+            if (variable->writer != NULL) variable->writer(code, layout, config, offset, token.tabs);
+            else CodeAppend(code, variable->value);
         }
     }
+}
+
+// Init template variables registry with built-in variables
+static void InitCodeVariables(void)
+{
+    if (codeVariables.count > 0) return;
+
+    // Layout general description variables
+    AddCodeVariable("GUILAYOUT_NAME", WriteLayoutName, NULL);
+    AddCodeVariable("GUILAYOUT_NAME_UPPERCASE", WriteLayoutNameUppercase, NULL);
+    AddCodeVariable("GUILAYOUT_NAME_LOWERCASE", WriteLayoutNameLowercase, NULL);
+    AddCodeVariable("GUILAYOUT_NAME_PASCALCASE", WriteLayoutNamePascalcase, NULL);
+    AddCodeVariable("GUILAYOUT_VERSION", WriteLayoutVersion, NULL);
+    AddCodeVariable("GUILAYOUT_DESCRIPTION", WriteLayoutDescription, NULL);
+    AddCodeVariable("GUILAYOUT_COMPANY", WriteLayoutCompany, NULL);
+    AddCodeVariable("GUILAYOUT_WINDOW_WIDTH", WriteWindowWidth, NULL);
+    AddCodeVariable("GUILAYOUT_WINDOW_HEIGHT", WriteWindowHeight, NULL);
+
+    // C IMPLEMENTATION
+    AddCodeVariable("GUILAYOUT_FUNCTION_DECLARATION_C", WriteFunctionsDeclarationC, NULL);
+    AddCodeVariable("GUILAYOUT_INITIALIZATION_C", WriteInitializationC, NULL);
+    AddCodeVariable("GUILAYOUT_DRAWING_C", WriteDrawingC, NULL);
+    AddCodeVariable("GUILAYOUT_DEINITIALIZATION_C", WriteDeinitializationC, NULL);
+    AddCodeVariable("GUILAYOUT_FUNCTION_DEFINITION_C", WriteFunctionsDefinitionC, NULL);
+
+    // H IMPLEMENTATION
+    AddCodeVariable("GUILAYOUT_STRUCT_TYPE", WriteStruct, NULL);
+    AddCodeVariable("GUILAYOUT_FUNCTIONS_DECLARATION_H", WriteFunctionsDeclarationH, NULL);
+    AddCodeVariable("GUILAYOUT_FUNCTION_INITIALIZE_H", WriteFunctionInitializeH, NULL);
+    AddCodeVariable("GUILAYOUT_FUNCTION_DRAWING_H", WriteFunctionDrawingH, NULL);
+
+    // TABLE IMPLEMENTATION (.h)
+    AddCodeVariable("GUILAYOUT_TABLE_STRUCT_TYPE", WriteTableStruct, NULL);
+    AddCodeVariable("GUILAYOUT_TABLE_DATA", WriteTableData, NULL);
+    AddCodeVariable("GUILAYOUT_TABLE_FUNCTION_INITIALIZE", WriteTableFunctionInitialize, NULL);
+    AddCodeVariable("GUILAYOUT_TABLE_FUNCTION_DRAWING", WriteTableFunctionDrawing, NULL);
+
+    // CONSTEXPR C++ IMPLEMENTATION (.hpp)
+    AddCodeVariable("GUILAYOUT_CONSTEXPR_DATA", WriteConstexprData, NULL);
+    AddCodeVariable("GUILAYOUT_CONSTEXPR_STATE", WriteConstexprState, NULL);
+    AddCodeVariable("GUILAYOUT_CONSTEXPR_CONSTRUCTOR", WriteConstexprConstructor, NULL);
+    AddCodeVariable("GUILAYOUT_CONSTEXPR_FUNCTION_DRAWING", WriteConstexprFunctionDrawing, NULL);
+}
+
+// Add variable to registry, returns variable index
+// NOTE: Variable name is expected not to be registered already
+static int AddCodeVariable(const char *name, CodeVariableWriter writer, const char *value)
+{
+    // Grow variables array if required
+    if (codeVariables.count >= codeVariables.capacity)
+    {
+        int capacity = (codeVariables.capacity > 0)? codeVariables.capacity*2 : 32;
+        CodeVariable *variables = (CodeVariable *)RL_REALLOC(codeVariables.variables, capacity*sizeof(CodeVariable));
+
+        if (variables == NULL) return -1;
+
+        codeVariables.variables = variables;
+        codeVariables.capacity = capacity;
+    }
 
-    // Restored all enabled anchors to reference window and offset
-    for (int a = 1; a < MAX_ANCHOR_POINTS; a++)
+    // Grow and rebuild hash table if required (load factor kept under 50%)
+    if ((codeVariables.count + 1)*2 > codeVariables.tableCapacity)
     {
-        if (layout->anchors[a].enabled)
+        int tableCapacity = (codeVariables.tableCapacity > 0)? codeVariables.tableCapacity*2 : 64;
+        int *table = (int *)RL_CALLOC(tableCapacity, sizeof(int));
+
+        if (table == NULL) return -1;
+
+        // Re-insert current variables into the new table
+        for (int i = 0; i < codeVariables.count; i++)
         {
-            layout->anchors[a].x += (int)(layout->refWindow.x + offset.x);
-            layout->anchors[a].y += (int)(layout->refWindow.y + offset.y);
+            const char *varName = codeVariables.variables[i].name;
+            int slot = (int)(GetCodeVariableHash(varName, (int)strlen(varName)) & (unsigned int)(tableCapacity - 1));
+            while (table[slot] != 0) slot = (slot + 1) & (tableCapacity - 1);
+            table[slot] = i + 1;
         }
+
+        RL_FREE(codeVariables.table);
+        codeVariables.table = table;
+        codeVariables.tableCapacity = tableCapacity;
     }
 
-    return toolstr;
+    int index = codeVariables.count;
+    CodeVariable *variable = &codeVariables.variables[index];
+    memset(variable, 0, sizeof(CodeVariable));
+
+    strncpy(variable->name, name, MAX_VARIABLE_NAME_SIZE);
+    variable->writer = writer;
+
+    if (value != NULL)
+    {
+        variable->value = (char *)RL_CALLOC(strlen(value) + 1, 1);
+        strcpy(variable->value, value);
+    }
+
+    int slot = (int)(GetCodeVariableHash(variable->name, (int)strlen(variable->name)) & (unsigned int)(codeVariables.tableCapacity - 1));
+    while (codeVariables.table[slot] != 0) slot = (slot + 1) & (codeVariables.tableCapacity - 1);
+    codeVariables.table[slot] = index + 1;
+
+    codeVariables.count++;
+
+    return index;
+}
+
+// Get variable name hash (FNV-1a)
+static unsigned int GetCodeVariableHash(const char *name, int length)
+{
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < length; i++) hash = (hash ^ (unsigned char)name[i])*16777619u;
+
+    return hash;
+}
+
+// Find variable in registry, returns variable index (-1 if not found)
+static int FindCodeVariable(const char *name, int length)
+{
+    if (codeVariables.tableCapacity == 0) return -1;
+
+    int slot = (int)(GetCodeVariableHash(name, length) & (unsigned int)(codeVariables.tableCapacity - 1));
+
+    while (codeVariables.table[slot] != 0)
+    {
+        int index = codeVariables.table[slot] - 1;
+        const char *varName = codeVariables.variables[index].name;
+
+        if ((strncmp(varName, name, length) == 0) && (varName[length] == '\0')) return index;
+
+        slot = (slot + 1) & (codeVariables.tableCapacity - 1);
+    }
+
+    return -1;
+}
+
+//----------------------------------------------------------------------------------
+// Template built-in variables writting functions
+//----------------------------------------------------------------------------------
+
+// Write layout name: $(GUILAYOUT_NAME)
+static void WriteLayoutName(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    CodeAppend(code, config.name);
+}
+
+// Write layout name uppercase: $(GUILAYOUT_NAME_UPPERCASE)
+static void WriteLayoutNameUppercase(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char name[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeAppend(code, CodeTextToUpper(config.name, name));
+}
+
+// Write layout name lowercase: $(GUILAYOUT_NAME_LOWERCASE)
+static void WriteLayoutNameLowercase(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char name[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeAppend(code, CodeTextToLower(config.name, name));
+}
+
+// Write layout name pascalcase: $(GUILAYOUT_NAME_PASCALCASE)
+static void WriteLayoutNamePascalcase(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char name[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeAppend(code, CodeTextToPascal(config.name, name));
+}
+
+// Write layout version: $(GUILAYOUT_VERSION)
+static void WriteLayoutVersion(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    CodeAppend(code, config.version);
+}
+
+// Write layout description: $(GUILAYOUT_DESCRIPTION)
+static void WriteLayoutDescription(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    CodeAppend(code, config.description);
+}
+
+// Write layout company: $(GUILAYOUT_COMPANY)
+static void WriteLayoutCompany(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    CodeAppend(code, config.company);
+}
+
+// Write window width: $(GUILAYOUT_WINDOW_WIDTH)
+static void WriteWindowWidth(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    if (layout->refWindow.width > 0) CodeAppendFormat(code, "%i", (int)layout->refWindow.width);
+    else CodeAppendFormat(code, "%i", 800);
+}
+
+// Write window height: $(GUILAYOUT_WINDOW_HEIGHT)
+static void WriteWindowHeight(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    if (layout->refWindow.height > 0) CodeAppendFormat(code, "%i", (int)layout->refWindow.height);
+    else CodeAppendFormat(code, "%i", 450);
+}
+
+//----------------------------------------------------------------------------------
+// Code builder functions
+//----------------------------------------------------------------------------------
+
+// Reserve code builder space for additional length
+// NOTE: Capacity is doubled to get amortized constant time appends
+static void CodeReserve(CodeBuilder *code, int length)
+{
+    if (code->fixed) return;
+
+    // Flush code to sink before growing, last characters are kept (they could be removed)
+    if ((code->sink.write != NULL) && ((code->length + length) > CODE_SINK_FLUSH_SIZE)) CodeFlush(code, CODE_SINK_KEEP_SIZE);
+
+    int required = code->length + length + 1;
+
+    if (required > code->capacity)
+    {
+        int capacity = (code->capacity > 0)? code->capacity : CODE_BUILDER_INITIAL_CAPACITY;
+        while (capacity < required) capacity *= 2;
+
+        char *text = (char *)RL_REALLOC(code->text, capacity);
+
+        if (text != NULL)
+        {
+            code->text = text;
+            code->capacity = capacity;
+        }
+    }
+}
+
+// Append text of given length to code
+static void CodeAppendLength(CodeBuilder *code, const char *text, int length)
+{
+    if (length <= 0) return;
+
+    CodeReserve(code, length);
+
+    if ((code->length + length) < code->capacity)
+    {
+        memcpy(code->text + code->length, text, length);
+        code->length += length;
+        code->text[code->length] = '\0';
+    }
+    else if (code->fixed)
+    {
+        // Copy only text fitting in buffer, full length is counted
+        int available = code->capacity - 1 - code->length;
+
+        if (available > 0)
+        {
+            memcpy(code->text + code->length, text, available);
+            code->text[code->length + available] = '\0';
+        }
+
+        code->length += length;
+    }
+}
+
+// Append formatted text to code
+static void CodeAppendFormat(CodeBuilder *code, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (length > 0)
+    {
+        CodeReserve(code, length);
+
+        if ((code->length + length) < code->capacity)
+        {
+            vsnprintf(code->text + code->length, length + 1, format, argsCopy);
+            code->length += length;
+        }
+        else if (code->fixed)
+        {
+            // Format into a temporal buffer to copy the fitting text
+            char *text = (char *)RL_MALLOC(length + 1);
+            vsnprintf(text, length + 1, format, argsCopy);
+            CodeAppendLength(code, text, length);
+            RL_FREE(text);
+        }
+    }
+
+    va_end(argsCopy);
+}
+
+// Append text to code
+static void CodeAppend(CodeBuilder *code, const char *text)
+{
+    if (text != NULL) CodeAppendLength(code, text, (int)strlen(text));
+}
+
+// Append tabs (4 spaces) to code
+static void CodeAppendTabs(CodeBuilder *code, int tabs)
+{
+    for (int t = 0; t < tabs; t++) CodeAppendLength(code, "    ", 4);
+}
+
+// Append text escaped as C string literal content, compiled string is the same as text
+// NOTE: Control characters are written as octal escape sequences (always 3 digits)
+static void CodeAppendEscaped(CodeBuilder *code, const char *text)
+{
+    char escaped[8] = { 0 };
+    int start = 0;
+
+    for (int i = 0; text[i] != '\0'; i++)
+    {
+        unsigned char c = (unsigned char)text[i];
+
+        if ((c == '\\') || (c == '"')) snprintf(escaped, 8, "\\%c", c);
+        else if (c == '\n') strcpy(escaped, "\\n");
+        else if (c == '\t') strcpy(escaped, "\\t");
+        else if ((c < 32) || (c == 127)) snprintf(escaped, 8, "\\%03o", c);
+        else continue;
+
+        CodeAppendLength(code, text + start, i - start);
+        CodeAppend(code, escaped);
+        start = i + 1;
+    }
+
+    CodeAppend(code, text + start);
+}
+
+// Remove last characters from code
+// NOTE: In case of sink, only characters not flushed can be removed (CODE_SINK_KEEP_SIZE)
+static void CodeRemove(CodeBuilder *code, int length)
+{
+    code->length -= length;
+    if (code->length < 0) code->length = 0;
+    if ((code->text != NULL) && (code->length < code->capacity)) code->text[code->length] = '\0';
+}
+
+// Flush code to sink, last characters kept in builder
+static void CodeFlush(CodeBuilder *code, int keep)
+{
+    int length = code->length - keep;
+
+    if ((code->sink.write != NULL) && (length > 0))
+    {
+        if (!code->sinkError && !code->sink.write(code->sink.userData, code->text, length)) code->sinkError = true;
+
+        memmove(code->text, code->text + length, keep);
+        code->length = keep;
+        code->text[code->length] = '\0';
+    }
 }
 
 //----------------------------------------------------------------------------------
@@ -256,7 +877,7 @@ char *GenLayoutCode(const char *buffer, GuiLayout *layout, Vector2 offset, GuiLa
 //----------------------------------------------------------------------------------
 
 // Write functions declaration code (.c)
-static void WriteFunctionsDeclarationC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
+static void WriteFunctionsDeclarationC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
 {
     if(config.exportButtonFunctions)
     {
@@ -267,68 +888,85 @@ static void WriteFunctionsDeclarationC(char *toolstr, int *pos, GuiLayout *layou
             int type = layout->controls[i].type;
             if (type == GUI_BUTTON || type == GUI_LABELBUTTON)
             {
+                char functionName[MAX_CODE_NAME_SIZE] = { 0 };
                 buttonsCount++;
-                TextAppend(toolstr, TextFormat("static void %s();", TextToPascal(layout->controls[i].name)), pos);
+                CodeAppendFormat(code, "static void %s();", CodeTextToPascal(GetLayoutString(layout, layout->controlsInfo[i].name), functionName));
                 if (config.fullComments)
                 {
-                    TABAPPEND(toolstr, pos, 4);
-                    TextAppend(toolstr, TextFormat("// %s: %s logic", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
+                    TABAPPEND(code, 4);
+                    CodeAppendFormat(code, "// %s: %s logic", controlTypeName[layout->controls[i].type], GetLayoutString(layout, layout->controlsInfo[i].name));
                 }
-                ENDLINEAPPEND(toolstr, pos);
-                TABAPPEND(toolstr, pos, tabs);
+                ENDLINEAPPEND(code);
+                TABAPPEND(code, tabs);
             }
         }
-        if (buttonsCount > 0) *pos -= 1;
+        if (buttonsCount > 0) CodeRemove(code, 1);
     }   
 }
 
 // Write variables initialization code (.c)
-static void WriteInitializationC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
+static void WriteInitializationC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
 {
     // Const text
-    if (config.defineTexts) WriteConstText(toolstr, pos, layout, config, tabs);
+    if (config.defineTexts) WriteConstText(code, layout, config, offset, tabs);
 
     // Anchors
-    if (config.exportAnchors && (layout->anchorCount > 0)) WriteAnchors(toolstr, pos, layout, config, true, true, "", tabs);
+    if (config.exportAnchors && (layout->anchorCount > 0)) WriteAnchors(code, layout, config, offset, true, true, "", tabs);
 
     // Control variables
-    if (layout->controlCount > 0) WriteControlsVariables(toolstr, pos, layout, config, true, true, "", tabs);
+    if (layout->controlCount > 0) WriteControlsVariables(code, layout, config, offset, true, true, "", tabs);
 
     // Rectangles
     if (config.defineRecs)
     {
-        ENDLINEAPPEND(toolstr, pos);
-        ENDLINEAPPEND(toolstr, pos);
-        TABAPPEND(toolstr, pos, tabs);
+        ENDLINEAPPEND(code);
+        ENDLINEAPPEND(code);
+        TABAPPEND(code, tabs);
         // Define controls rectangles
         if (config.fullComments)
         {
-            TextAppend(toolstr, "// Define controls rectangles", pos);
-            ENDLINEAPPEND(toolstr, pos);
-            TABAPPEND(toolstr, pos, tabs);
+            CodeAppend(code, "// Define controls rectangles");
+            ENDLINEAPPEND(code);
+            TABAPPEND(code, tabs);
         }
-        TextAppend(toolstr, TextFormat("Rectangle layoutRecs[%i] = {", layout->controlCount), pos);
-        ENDLINEAPPEND(toolstr, pos);
+        CodeAppendFormat(code, "Rectangle layoutRecs[%i] = {", layout->controlCount);
+        ENDLINEAPPEND(code);
 
         for (int k = 0; k < layout->controlCount; k++)
         {
-            TABAPPEND(toolstr, pos, tabs + 1);
-            WriteRectangleVariables(toolstr, pos, layout->controls[k], config.exportAnchors, config.fullComments, "", tabs, false);
-            ENDLINEAPPEND(toolstr, pos);
+            TABAPPEND(code, tabs + 1);
+            WriteRectangleVariables(code, layout, k, offset, config.exportAnchors, config.fullComments, "", tabs, false);
+            ENDLINEAPPEND(code);
         }
-        TABAPPEND(toolstr, pos, tabs);
-        TextAppend(toolstr, "};", pos);
+        TABAPPEND(code, tabs);
+        CodeAppend(code, "};");
     }
+
+    // Static controls cache
+    WriteStaticControlsVariables(code, layout, config, true, tabs);
 }
 
 // Write drawing code (.c)
-static void WriteDrawingC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
+static void WriteDrawingC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    if (layout->controlCount > 0) WriteControlsDrawing(code, layout, config, offset, "", tabs);
+}
+
+// Write de-initialization code (.c)
+// NOTE: Only static controls cache requires unloading, code is placed before following template text (same line)
+static void WriteDeinitializationC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
 {
-    if (layout->controlCount > 0) WriteControlsDrawing(toolstr, pos, layout, config, "", tabs);
+    int groupCount = GetCodeStaticControls(layout, config, NULL);
+
+    if (groupCount > 0)
+    {
+        CodeAppendFormat(code, "for (int i = 0; i < %i; i++) UnloadRenderTexture(layoutStaticTargets[i]);", groupCount);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
 }
 
 // Write functions definition code (.c)
-static void WriteFunctionsDefinitionC(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
+static void WriteFunctionsDefinitionC(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
 {
     if(config.exportButtonFunctions)
     {
@@ -339,19 +977,20 @@ static void WriteFunctionsDefinitionC(char *toolstr, int *pos, GuiLayout *layout
             {
                 if (config.fullComments)
                 {
-                    TextAppend(toolstr, TextFormat("// %s: %s logic", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
-                    ENDLINEAPPEND(toolstr, pos);
-                    TABAPPEND(toolstr, pos, tabs);
+                    CodeAppendFormat(code, "// %s: %s logic", controlTypeName[layout->controls[i].type], GetLayoutString(layout, layout->controlsInfo[i].name));
+                    ENDLINEAPPEND(code);
+                    TABAPPEND(code, tabs);
                 }
 
-                TextAppend(toolstr, TextFormat("static void %s()", TextToPascal(layout->controls[i].name)), pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-                TextAppend(toolstr, "{", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
-                TextAppend(toolstr, "// TODO: Implement control logic", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-                TextAppend(toolstr, "}", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                char functionName[MAX_CODE_NAME_SIZE] = { 0 };
+                CodeAppendFormat(code, "static void %s()", CodeTextToPascal(GetLayoutString(layout, layout->controlsInfo[i].name), functionName));
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+                CodeAppend(code, "{");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+                CodeAppend(code, "// TODO: Implement control logic");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+                CodeAppend(code, "}");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
             }
         }
     }
@@ -362,143 +1001,1181 @@ static void WriteFunctionsDefinitionC(char *toolstr, int *pos, GuiLayout *layout
 //----------------------------------------------------------------------------------
 
 // Write state structure code (.h)
-static void WriteStruct(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
+static void WriteStruct(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
 {
-    TABAPPEND(toolstr, pos, tabs);
-    TextAppend(toolstr, "typedef struct {", pos);
-    ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "typedef struct {");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
 
     // Write anchors variables (forced on .h)
-    if (config.exportAnchors && (layout->anchorCount > 0)) WriteAnchors(toolstr, pos, layout, config, true, false, "", tabs + 1);
+    if (config.exportAnchors && (layout->anchorCount > 0)) WriteAnchors(code, layout, config, offset, true, false, "", tabs + 1);
 
     // Write controls variables
-    if (layout->controlCount > 0) WriteControlsVariables(toolstr, pos, layout, config, true, false, "", tabs + 1);
+    if (layout->controlCount > 0) WriteControlsVariables(code, layout, config, offset, true, false, "", tabs + 1);
 
     // Export rectangles
     if (config.defineRecs)
     {
-        ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
 
         // Write rectangles
         if (config.fullComments)
         {
-            TextAppend(toolstr, "// Define rectangles", pos);
-            ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
+            CodeAppend(code, "// Define rectangles");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
         }
 
-        TextAppend(toolstr, TextFormat("Rectangle layoutRecs[%i];", layout->controlCount), pos);
+        CodeAppendFormat(code, "Rectangle layoutRecs[%i];", layout->controlCount);
+    }
+
+    // Static controls cache
+    WriteStaticControlsVariables(code, layout, config, false, tabs + 1);
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// Custom state variables (depend on development software)");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// NOTE: This variables should be added manually if required");
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeAppendFormat(code, "} Gui%sState;", CodeTextToPascal(config.name, layoutName));
+}
+
+// Write variables declaration code (.h)
+static void WriteFunctionsDeclarationH(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+
+    CodeAppendFormat(code, "Gui%sState InitGui%s(void);", layoutName, layoutName);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppendFormat(code, "void Gui%s(Gui%sState *state);", layoutName, layoutName);    
+
+    // Static controls cache requires unloading render texture
+    if (GetCodeStaticControls(layout, config, NULL) > 0)
+    {
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppendFormat(code, "void UnloadGui%s(Gui%sState *state);", layoutName, layoutName);
+    }
+
+    // Generate buttons functions declaration
+    if(config.exportButtonFunctions)
+    {
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        WriteFunctionsDeclarationC(code, layout, config, offset, tabs);
+    }   
+}
+
+// Write initialization function code (.h)
+static void WriteFunctionInitializeH(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+
+     // Export InitGuiLayout function definition
+    CodeAppendFormat(code, "Gui%sState InitGui%s(void)", layoutName, layoutName);
+    ENDLINEAPPEND(code);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code);
+    TABAPPEND(code, tabs + 1);
+    CodeAppendFormat(code, "Gui%sState state = { 0 };", layoutName);
+    ENDLINEAPPEND(code);
+    ENDLINEAPPEND(code);
+    TABAPPEND(code, tabs + 1);
+
+    // Init anchors (forced on .h)
+    if (config.exportAnchors && (layout->anchorCount > 0)) WriteAnchors(code, layout, config, offset, false, true, "state.", tabs + 1);
+
+    // Init controls variables
+    if (layout->controlCount > 0)
+    {
+        WriteControlsVariables(code, layout, config, offset, false, true, "state.", tabs + 1);
+    }
+
+    // Define controls rectangles if required
+    if (config.defineRecs)
+    {
+        ENDLINEAPPEND(code);
+        ENDLINEAPPEND(code);
+        TABAPPEND(code, tabs + 1);
+
+        // Define controls rectangles
+        if (config.fullComments)
+        {
+            CodeAppend(code, "// Init controls rectangles");
+            ENDLINEAPPEND(code);
+            TABAPPEND(code, tabs + 1);
+        }
+
+        for (int k = 0; k < layout->controlCount; k++)
+        {
+            CodeAppendFormat(code, "state.layoutRecs[%i] = ", k);
+            WriteRectangleVariables(code, layout, k, offset, config.exportAnchors, config.fullComments, "state.", tabs, true);
+            ENDLINEAPPEND(code);
+            TABAPPEND(code, tabs + 1);
+        }
+
+        CodeRemove(code, (tabs + 1)*4 + 1);
+    }
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// Custom variables initialization");
+    ENDLINEAPPEND(code);
+
+    // Return gui state after defining all its variables
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "return state;");
+
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+    
+    // Generate buttons functions implementation
+    if(config.exportButtonFunctions)
+    {
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        WriteFunctionsDefinitionC(code, layout, config, offset, tabs);
+    }  
+}
+
+// Write functions drawing code (.h)
+static void WriteFunctionDrawingH(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    // NOTE: Drawing function only exported if layout contains controls
+    if (layout->controlCount == 0) return;
+
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+
+    // Export GuiLayout draw function
+    CodeAppendFormat(code, "void Gui%s(Gui%sState *state)", layoutName, layoutName);
+    ENDLINEAPPEND(code);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code);
+    TABAPPEND(code, tabs + 1);
+
+    // Const text
+    if (config.defineTexts) WriteConstText(code, layout, config, offset, tabs + 1);
+
+    // Controls draw
+    if (layout->controlCount > 0) WriteControlsDrawing(code, layout, config, offset, "state->", tabs + 1);
+
+    ENDLINEAPPEND(code);
+    CodeAppend(code, "}");
+
+    // Export GuiLayout unload function, only required for static controls cache
+    int groupCount = GetCodeStaticControls(layout, config, NULL);
+    if (groupCount > 0)
+    {
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppendFormat(code, "void UnloadGui%s(Gui%sState *state)", layoutName, layoutName);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "for (int i = 0; i < %i; i++) UnloadRenderTexture(state->layoutStaticTargets[i]);", groupCount);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "}");
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Table writting code functions (.h)
+//----------------------------------------------------------------------------------
+
+// Write table state struct code (.h)
+// NOTE: Controls state is stored in a generic state struct array, in drawing order
+static void WriteTableStruct(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    char layoutNameUpper[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+    CodeTextToUpper(config.name, layoutNameUpper);
+
+    int textCount = GetTableTextsCount(layout);
+
+    // NOTE: Arrays size must be at least 1 to be valid C
+    if (config.exportAnchors)
+    {
+        CodeAppendFormat(code, "#define GUI_%s_ANCHORS_COUNT %i", layoutNameUpper, GetCodeAnchorsCount(layout));
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppendFormat(code, "#define GUI_%s_CONTROLS_COUNT %i", layoutNameUpper, (layout->controlCount > 0)? layout->controlCount : 1);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    if (textCount > 0)
+    {
+        CodeAppendFormat(code, "#define GUI_%s_TEXTS_COUNT %i", layoutNameUpper, textCount);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    // Generic control state, every control type only uses its own fields
+    CodeAppend(code, "typedef struct {");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "bool active;                    // WindowBox, Toggle: active, CheckBox: checked, Button, LabelButton: pressed");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "bool editMode;                  // DropdownBox, TextBox, ValueBox, Spinner: edit mode");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "int value;                      // ToggleGroup, ComboBox, DropdownBox, ListView: active, ValueBox, Spinner: value");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "int scrollIndex;                // ListView: scroll index");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "float valuef;                   // Slider, SliderBar, ProgressBar: value");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Color color;                    // ColorPicker: value");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Rectangle scrollView;           // ScrollPanel: scroll view");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Vector2 scrollOffset;           // ScrollPanel: scroll offset");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Vector2 boundsOffset;           // ScrollPanel: bounds offset");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppendFormat(code, "} Gui%sControlState;", layoutName);
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    // Layout state
+    CodeAppend(code, "typedef struct {");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    if (config.exportAnchors)
+    {
+        CodeAppendFormat(code, "Vector2 anchors[GUI_%s_ANCHORS_COUNT];", layoutNameUpper);
+        if (config.fullComments) CodeAppend(code, "    // Anchors position (anchor id as index)");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    }
+    CodeAppendFormat(code, "Gui%sControlState controls[GUI_%s_CONTROLS_COUNT];", layoutName, layoutNameUpper);
+    if (config.fullComments) CodeAppend(code, "    // Controls state (drawing order)");
+    if (textCount > 0)
+    {
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "char texts[GUI_%s_TEXTS_COUNT][%i];", layoutNameUpper, MAX_CONTROL_TEXT_LENGTH);
+        if (config.fullComments) CodeAppend(code, "    // TextBox controls text (drawing order)");
+    }
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// Custom state variables (depend on development software)");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// NOTE: This variables should be added manually if required");
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppendFormat(code, "} Gui%sState;", layoutName);
+}
+
+// Write table controls data code (.h)
+// NOTE: Controls data is written as static const arrays, in drawing order: types, anchors, parent windows,
+// rectangles and texts (offsets into a single texts string), so code size is roughly constant per control
+static void WriteTableData(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    if (layout->controlCount == 0) return;
+
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    char layoutNameUpper[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+    CodeTextToUpper(config.name, layoutNameUpper);
+
+    int *order = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int *parent = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int *position = (int *)RL_CALLOC(layout->controlCount, sizeof(int));     // Control position in drawing order
+    int *values = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    GetControlsDrawOrder(layout, order, parent);
+
+    bool windowExist = false;
+    for (int k = 0; k < layout->controlCount; k++)
+    {
+        position[order[k]] = k;
+        if (layout->controls[order[k]].type == GUI_WINDOWBOX) windowExist = true;
+    }
+
+    // Controls types
+    for (int k = 0; k < layout->controlCount; k++) values[k] = layout->controls[order[k]].type;
+    WriteTableValues(code, "unsigned char", layoutName, layoutNameUpper, "ControlTypes", values, layout->controlCount, tabs);
+
+    // Controls anchors (anchor id), only required if anchors are exported
+    if (config.exportAnchors)
+    {
+        for (int k = 0; k < layout->controlCount; k++) values[k] = layout->controls[order[k]].anchorId;
+        WriteTableValues(code, "unsigned short", layoutName, layoutNameUpper, "ControlAnchors", values, layout->controlCount, tabs);
+    }
+
+    // Controls parent window (drawing order position, -1 if none), only required if windows exist
+    if (windowExist)
+    {
+        for (int k = 0; k < layout->controlCount; k++) values[k] = (parent[order[k]] >= 0)? position[parent[order[k]]] : -1;
+        WriteTableValues(code, "int", layoutName, layoutNameUpper, "ControlParents", values, layout->controlCount, tabs);
+    }
+
+    // Controls texts offsets (-1 if no text)
+    // NOTE: Texts are escaped when written, offsets are computed from texts length
+    int textsLength = 0;
+    for (int k = 0; k < layout->controlCount; k++)
+    {
+        GuiLayoutControlInfo info = layout->controlsInfo[order[k]];
+
+        if (info.text.length == 0) values[k] = -1;
+        else
+        {
+            values[k] = textsLength;
+            textsLength += info.text.length + 1;
+        }
+    }
+    WriteTableValues(code, "int", layoutName, layoutNameUpper, "ControlTexts", values, layout->controlCount, tabs);
+
+    // Controls rectangles
+    // NOTE: Rectangles are relative to anchor if anchors are exported
+    CodeAppendFormat(code, "static const Rectangle gui%sControlRecs[GUI_%s_CONTROLS_COUNT] = {", layoutName, layoutNameUpper);
+    ENDLINEAPPEND(code);
+    for (int k = 0; k < layout->controlCount; k++)
+    {
+        GuiLayoutControl control = GetCodeControl(layout, order[k], offset);
+        GuiAnchorPoint anchor = GetCodeAnchor(layout, control.anchorId, offset);
+
+        if (!config.exportAnchors || (control.anchorId == 0))
+        {
+            if (control.anchorId > 0) { control.rec.x += anchor.x; control.rec.y += anchor.y; }
+            else { control.rec.x -= anchor.x; control.rec.y -= anchor.y; }
+        }
+
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "{ %i, %i, %i, %i },", (int)control.rec.x, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height);
+        if (config.fullComments)
+        {
+            TABAPPEND(code, 1);
+            CodeAppendFormat(code, "// %s: %s", controlTypeName[control.type], GetLayoutString(layout, layout->controlsInfo[order[k]].name));
+        }
+        ENDLINEAPPEND(code);
+    }
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "};");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    // Controls texts, null-terminated and concatenated in a single string
+    // NOTE: Every text is written as a separate string literal, special characters escaped
+    CodeAppendFormat(code, "static const char gui%sTexts[] =", layoutName);
+    if (textsLength == 0) CodeAppend(code, " \"\"");
+    for (int k = 0; k < layout->controlCount; k++)
+    {
+        GuiLayoutControlInfo info = layout->controlsInfo[order[k]];
+
+        if (info.text.length > 0)
+        {
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "\"");
+            CodeAppendEscaped(code, GetLayoutString(layout, info.text));
+            CodeAppend(code, "\\0\"");
+        }
+    }
+    CodeAppend(code, ";");
+
+    RL_FREE(order);
+    RL_FREE(parent);
+    RL_FREE(position);
+    RL_FREE(values);
+}
+
+// Write table initialization function code (.h)
+static void WriteTableFunctionInitialize(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    char layoutNameUpper[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+    CodeTextToUpper(config.name, layoutNameUpper);
+
+    CodeAppendFormat(code, "Gui%sState InitGui%s(void)", layoutName, layoutName);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppendFormat(code, "Gui%sState state = { 0 };", layoutName);
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+
+    // Init anchors
+    if (config.exportAnchors && (layout->anchorCount > 0))
+    {
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "// Init anchors");
+            ENDLINEAPPEND(code);
+        }
+
+        for (int i = 1; i < layout->anchorCapacity; i++)
+        {
+            if (layout->anchors[i].enabled)
+            {
+                GuiAnchorPoint position = GetCodeAnchor(layout, i, offset);
+
+                TABAPPEND(code, tabs + 1);
+                CodeAppendFormat(code, "state.anchors[%i] = (Vector2){ %i, %i };", i, position.x, position.y);
+                if (config.fullComments)
+                {
+                    TABAPPEND(code, 1);
+                    CodeAppendFormat(code, "// %s", layout->anchors[i].name);
+                }
+                ENDLINEAPPEND(code);
+            }
+        }
+        ENDLINEAPPEND(code);
+    }
+
+    // Init controls state, only window boxes, toggles and text boxes require it
+    bool present[GUI_DUMMYREC + 1] = { 0 };
+    for (int i = 0; i < layout->controlCount; i++) present[layout->controls[i].type] = true;
+
+    bool activeExist = present[GUI_WINDOWBOX] || present[GUI_TOGGLE];
+    bool textExist = present[GUI_TEXTBOX] || present[GUI_TEXTBOXMULTI];
+
+    if (activeExist || textExist)
+    {
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "// Init controls state");
+            ENDLINEAPPEND(code);
+        }
+
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "for (int i = 0%s; i < GUI_%s_CONTROLS_COUNT; i++)", textExist? ", t = 0" : "", layoutNameUpper);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "switch (gui%sControlTypes[i])", layoutName);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code);
+
+        if (activeExist)
+        {
+            if (present[GUI_WINDOWBOX])
+            {
+                TABAPPEND(code, tabs + 3);
+                CodeAppendFormat(code, "case %i:     // %s", GUI_WINDOWBOX, controlTypeName[GUI_WINDOWBOX]);
+                ENDLINEAPPEND(code);
+            }
+            if (present[GUI_TOGGLE])
+            {
+                TABAPPEND(code, tabs + 3);
+                CodeAppendFormat(code, "case %i:     // %s", GUI_TOGGLE, controlTypeName[GUI_TOGGLE]);
+                ENDLINEAPPEND(code);
+            }
+            TABAPPEND(code, tabs + 3);
+            CodeAppend(code, "{");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 4);
+            CodeAppend(code, "state.controls[i].active = true;");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 3);
+            CodeAppend(code, "} break;");
+            ENDLINEAPPEND(code);
+        }
+        if (textExist)
+        {
+            TABAPPEND(code, tabs + 3);
+            CodeAppendFormat(code, "case %i:    // %s", GUI_TEXTBOX, controlTypeName[GUI_TEXTBOX]);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 3);
+            CodeAppendFormat(code, "case %i:    // %s", GUI_TEXTBOXMULTI, controlTypeName[GUI_TEXTBOXMULTI]);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 3);
+            CodeAppend(code, "{");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 4);
+            CodeAppendFormat(code, "if (gui%sControlTexts[i] >= 0) strncpy(state.texts[t], gui%sTexts + gui%sControlTexts[i], %i);", layoutName, layoutName, layoutName, MAX_CONTROL_TEXT_LENGTH - 1);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 4);
+            CodeAppend(code, "t++;");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 3);
+            CodeAppend(code, "} break;");
+            ENDLINEAPPEND(code);
+        }
+
+        TABAPPEND(code, tabs + 3);
+        CodeAppend(code, "default: break;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// Custom variables initialization");
+    ENDLINEAPPEND(code);
+
+    // Return gui state after defining all its variables
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "return state;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+}
+
+// Write table drawing function code (.h)
+// NOTE: Controls are drawn in a loop over table data, only present control types are written,
+// controls inside a window box are skipped if window is closed and dropdowns lock gui on edit mode
+static void WriteTableFunctionDrawing(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    char layoutNameUpper[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+    CodeTextToUpper(config.name, layoutNameUpper);
+
+    CodeAppendFormat(code, "void Gui%s(Gui%sState *state)", layoutName, layoutName);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code);
+
+    if (layout->controlCount == 0)
+    {
+        TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "(void)state;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "}");
+        return;
+    }
+
+    bool present[GUI_DUMMYREC + 1] = { 0 };
+    for (int i = 0; i < layout->controlCount; i++) present[layout->controls[i].type] = true;
+
+    bool textExist = present[GUI_TEXTBOX] || present[GUI_TEXTBOXMULTI];
+    bool textUsed = false;      // Any control type using text parameter
+    for (int type = 0; type <= GUI_DUMMYREC; type++)
+    {
+        if (present[type] && (type != GUI_TEXTBOX) && (type != GUI_TEXTBOXMULTI)) textUsed = true;
+    }
+
+    // If dropdown control exist, lock gui while any dropdown is in edit mode
+    if (present[GUI_DROPDOWNBOX])
+    {
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "// Lock gui while any dropdown is in edit mode");
+            ENDLINEAPPEND(code);
+        }
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "for (int i = 0; i < GUI_%s_CONTROLS_COUNT; i++)", layoutNameUpper);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "if ((gui%sControlTypes[i] == %i) && state->controls[i].editMode) GuiLock();", layoutName, GUI_DROPDOWNBOX);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+    }
+
+    if (config.fullComments)
+    {
+        TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "// Draw controls");
+        ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs + 1);
+    CodeAppendFormat(code, "for (int i = 0%s; i < GUI_%s_CONTROLS_COUNT; i++)", textExist? ", t = 0" : "", layoutNameUpper);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+    CodeAppendFormat(code, "Gui%sControlState *control = &state->controls[i];", layoutName);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+    CodeAppendFormat(code, "Rectangle rec = gui%sControlRecs[i];", layoutName);
+    ENDLINEAPPEND(code);
+    if (config.exportAnchors)
+    {
+        TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "rec.x += state->anchors[gui%sControlAnchors[i]].x;", layoutName);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "rec.y += state->anchors[gui%sControlAnchors[i]].y;", layoutName);
+        ENDLINEAPPEND(code);
+    }
+    if (textUsed)
+    {
+        TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "const char *text = (gui%sControlTexts[i] >= 0)? (gui%sTexts + gui%sControlTexts[i]) : NULL;", layoutName, layoutName, layoutName);
+        ENDLINEAPPEND(code);
+    }
+    if (textExist)
+    {
+        // NOTE: Editable texts index is increased before skipping controls, to keep texts aligned
+        TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "int textId = t;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "if ((gui%sControlTypes[i] == %i) || (gui%sControlTypes[i] == %i)) t++;", layoutName, GUI_TEXTBOX, layoutName, GUI_TEXTBOXMULTI);
+        ENDLINEAPPEND(code);
+    }
+    ENDLINEAPPEND(code);
+
+    if (present[GUI_WINDOWBOX])
+    {
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 2);
+            CodeAppend(code, "// Skip closed window boxes and controls inside a closed window box");
+            ENDLINEAPPEND(code);
+        }
+        TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "if ((gui%sControlTypes[i] == %i) && !control->active) continue;", layoutName, GUI_WINDOWBOX);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "if ((gui%sControlParents[i] >= 0) && !state->controls[gui%sControlParents[i]].active) continue;", layoutName, layoutName);
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs + 2);
+    CodeAppendFormat(code, "switch (gui%sControlTypes[i])", layoutName);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code);
+
+    for (int type = 0; type <= GUI_DUMMYREC; type++)
+    {
+        if (!present[type]) continue;
+
+        TABAPPEND(code, tabs + 3);
+        CodeAppendFormat(code, "case %i: ", type);
+        switch (type)
+        {
+            case GUI_WINDOWBOX: CodeAppend(code, "control->active = !GuiWindowBox(rec, text); break;"); break;
+            case GUI_GROUPBOX: CodeAppend(code, "GuiGroupBox(rec, text); break;"); break;
+            case GUI_LINE: CodeAppend(code, "GuiLine(rec, text); break;"); break;
+            case GUI_PANEL: CodeAppend(code, "GuiPanel(rec, text); break;"); break;
+            case GUI_LABEL: CodeAppend(code, "GuiLabel(rec, text); break;"); break;
+            case GUI_BUTTON: CodeAppend(code, "control->active = GuiButton(rec, text); break;"); break;
+            case GUI_LABELBUTTON: CodeAppend(code, "control->active = GuiLabelButton(rec, text); break;"); break;
+            case GUI_CHECKBOX: CodeAppend(code, "GuiCheckBox(rec, text, &control->active); break;"); break;
+            case GUI_TOGGLE: CodeAppend(code, "GuiToggle(rec, text, &control->active); break;"); break;
+            case GUI_TOGGLEGROUP: CodeAppend(code, "GuiToggleGroup(rec, text, &control->value); break;"); break;
+            case GUI_COMBOBOX: CodeAppend(code, "GuiComboBox(rec, text, &control->value); break;"); break;
+            case GUI_DROPDOWNBOX: CodeAppend(code, "if (GuiDropdownBox(rec, text, &control->value, control->editMode)) control->editMode = !control->editMode; break;"); break;
+            case GUI_TEXTBOX: CodeAppendFormat(code, "if (GuiTextBox(rec, state->texts[textId], %i, control->editMode)) control->editMode = !control->editMode; break;", MAX_CONTROL_TEXT_LENGTH); break;
+            case GUI_TEXTBOXMULTI: CodeAppendFormat(code, "if (GuiTextBoxMulti(rec, state->texts[textId], %i, control->editMode)) control->editMode = !control->editMode; break;", MAX_CONTROL_TEXT_LENGTH); break;
+            case GUI_VALUEBOX: CodeAppend(code, "if (GuiValueBox(rec, text, &control->value, 0, 100, control->editMode)) control->editMode = !control->editMode; break;"); break;
+            case GUI_SPINNER: CodeAppend(code, "if (GuiSpinner(rec, text, &control->value, 0, 100, control->editMode)) control->editMode = !control->editMode; break;"); break;
+            case GUI_SLIDER: CodeAppend(code, "GuiSlider(rec, text, NULL, &control->valuef, 0, 100); break;"); break;
+            case GUI_SLIDERBAR: CodeAppend(code, "GuiSliderBar(rec, text, NULL, &control->valuef, 0, 100); break;"); break;
+            case GUI_PROGRESSBAR: CodeAppend(code, "GuiProgressBar(rec, text, NULL, &control->valuef, 0, 1); break;"); break;
+            case GUI_STATUSBAR: CodeAppend(code, "GuiStatusBar(rec, text); break;"); break;
+            case GUI_SCROLLPANEL: CodeAppend(code, "GuiScrollPanel((Rectangle){ rec.x, rec.y, rec.width - control->boundsOffset.x, rec.height - control->boundsOffset.y }, text, rec, &control->scrollOffset, &control->scrollView); break;"); break;
+            case GUI_LISTVIEW: CodeAppend(code, "GuiListView(rec, text, &control->scrollIndex, &control->value); break;"); break;
+            case GUI_COLORPICKER: CodeAppend(code, "GuiColorPicker(rec, text, &control->color); break;"); break;
+            case GUI_DUMMYREC: CodeAppend(code, "GuiDummyRec(rec, text); break;"); break;
+            default: break;
+        }
+
+        if (config.fullComments)
+        {
+            TABAPPEND(code, 1);
+            CodeAppendFormat(code, "// %s", controlTypeName[type]);
+        }
+        ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs + 3);
+    CodeAppend(code, "default: break;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+    CodeAppend(code, "}");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "}");
+    ENDLINEAPPEND(code);
+
+    if (present[GUI_DROPDOWNBOX])
+    {
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "GuiUnlock();");
+        ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+}
+
+// Write table values array code (.h), one value per control
+static void WriteTableValues(CodeBuilder *code, const char *type, const char *layoutName, const char *layoutNameUpper, const char *field, const int *values, int valueCount, int tabs)
+{
+    CodeAppendFormat(code, "static const %s gui%s%s[GUI_%s_CONTROLS_COUNT] = {", type, layoutName, field, layoutNameUpper);
+
+    for (int i = 0; i < valueCount; i++)
+    {
+        if ((i%16) == 0) { ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1); }
+        else CodeAppend(code, " ");
+        CodeAppendFormat(code, "%i,", values[i]);
+    }
+
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "};");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+}
+
+// Get table editable texts count (TextBox controls)
+static int GetTableTextsCount(const GuiLayout *layout)
+{
+    int count = 0;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        if ((layout->controls[i].type == GUI_TEXTBOX) || (layout->controls[i].type == GUI_TEXTBOXMULTI)) count++;
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Constexpr C++ writting code functions (.hpp)
+//----------------------------------------------------------------------------------
+
+// Write constexpr controls data code (.hpp), layout struct members
+// NOTE: Controls data is written as static constexpr arrays, in drawing order, rectangles are relative
+// to anchor if anchors are exported, so anchors position is the only runtime input
+static void WriteConstexprData(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    int textCount = GetTableTextsCount(layout);
+
+    if (config.exportAnchors)
+    {
+        CodeAppendFormat(code, "static constexpr std::size_t AnchorsCount = %i;", GetCodeAnchorsCount(layout));
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppendFormat(code, "static constexpr std::size_t ControlsCount = %i;", layout->controlCount);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppendFormat(code, "static constexpr std::size_t TextsCount = %i;", textCount);
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    // Control data type
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Control data: type, anchor id, parent window (drawing order, -1 if none), rectangle and text");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppend(code, "struct ControlData {");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "int type;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    if (config.exportAnchors)
+    {
+        CodeAppend(code, "int anchor;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    }
+    CodeAppend(code, "int parent;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Rectangle rec;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "const char *text;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "};");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    // Anchors default position (anchor id as index)
+    if (config.exportAnchors)
+    {
+        if (config.fullComments)
+        {
+            CodeAppend(code, "// Anchors default position (anchor id as index)");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        }
+        CodeAppend(code, "static constexpr std::array<Vector2, AnchorsCount> defaultAnchors = {{");
+        ENDLINEAPPEND(code);
+        int anchorsCount = GetCodeAnchorsCount(layout);
+        for (int i = 0; i < anchorsCount; i++)
+        {
+            GuiAnchorPoint position = { 0 };
+            if ((i > 0) && layout->anchors[i].enabled) position = GetCodeAnchor(layout, i, offset);
+
+            TABAPPEND(code, tabs + 1);
+            CodeAppendFormat(code, "{ %i, %i },", position.x, position.y);
+            if (config.fullComments && (i > 0) && layout->anchors[i].enabled)
+            {
+                TABAPPEND(code, 1);
+                CodeAppendFormat(code, "// %s", layout->anchors[i].name);
+            }
+            ENDLINEAPPEND(code);
+        }
+        TABAPPEND(code, tabs);
+        CodeAppend(code, "}};");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+
+    // Controls data
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Controls data (drawing order)");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+
+    if (layout->controlCount == 0)
+    {
+        CodeAppend(code, "static constexpr std::array<ControlData, ControlsCount> controlsData = {};");
+        return;
+    }
+
+    int *order = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int *parent = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int *position = (int *)RL_CALLOC(layout->controlCount, sizeof(int));     // Control position in drawing order
+    GetControlsDrawOrder(layout, order, parent);
+
+    for (int k = 0; k < layout->controlCount; k++) position[order[k]] = k;
+
+    CodeAppend(code, "static constexpr std::array<ControlData, ControlsCount> controlsData = {{");
+    ENDLINEAPPEND(code);
+    for (int k = 0; k < layout->controlCount; k++)
+    {
+        GuiLayoutControl control = GetCodeControl(layout, order[k], offset);
+        GuiAnchorPoint anchor = GetCodeAnchor(layout, control.anchorId, offset);
+        GuiLayoutControlInfo info = layout->controlsInfo[order[k]];
+
+        // NOTE: Rectangles are relative to anchor if anchors are exported (same as table template)
+        if (!config.exportAnchors || (control.anchorId == 0))
+        {
+            if (control.anchorId > 0) { control.rec.x += anchor.x; control.rec.y += anchor.y; }
+            else { control.rec.x -= anchor.x; control.rec.y -= anchor.y; }
+        }
+
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "{ %i, ", control.type);
+        if (config.exportAnchors) CodeAppendFormat(code, "%i, ", control.anchorId);
+        CodeAppendFormat(code, "%i, { %i, %i, %i, %i }, ", (parent[order[k]] >= 0)? position[parent[order[k]]] : -1,
+            (int)control.rec.x, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height);
+        if (info.text.length > 0)
+        {
+            CodeAppend(code, "\"");
+            CodeAppendEscaped(code, GetLayoutString(layout, info.text));
+            CodeAppend(code, "\" },");
+        }
+        else CodeAppend(code, "nullptr },");
+        if (config.fullComments)
+        {
+            TABAPPEND(code, 1);
+            CodeAppendFormat(code, "// %s: %s", controlTypeName[control.type], GetLayoutString(layout, info.name));
+        }
+        ENDLINEAPPEND(code);
+    }
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "}};");
+
+    RL_FREE(order);
+    RL_FREE(parent);
+    RL_FREE(position);
+}
+
+// Write constexpr layout state code (.hpp), layout struct members
+// NOTE: Controls state is stored in a generic state struct array, in drawing order (same as table template)
+static void WriteConstexprState(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Control state, every control type only uses its own fields");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppend(code, "struct ControlState {");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "bool active = false;            // WindowBox, Toggle: active, CheckBox: checked, Button, LabelButton: pressed");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "bool editMode = false;          // DropdownBox, TextBox, ValueBox, Spinner: edit mode");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "int value = 0;                  // ToggleGroup, ComboBox, DropdownBox, ListView: active, ValueBox, Spinner: value");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "int scrollIndex = 0;            // ListView: scroll index");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "float valuef = 0.0f;            // Slider, SliderBar, ProgressBar: value");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Color color = { 0, 0, 0, 0 };   // ColorPicker: value");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Rectangle scrollView = { 0, 0, 0, 0 };  // ScrollPanel: scroll view");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Vector2 scrollOffset = { 0, 0 };        // ScrollPanel: scroll offset");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "Vector2 boundsOffset = { 0, 0 };        // ScrollPanel: bounds offset");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "};");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    if (config.exportAnchors)
+    {
+        CodeAppend(code, "std::array<Vector2, AnchorsCount> anchors = defaultAnchors;");
+        if (config.fullComments) CodeAppend(code, "    // Anchors position (anchor id as index), runtime input");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppend(code, "std::array<ControlState, ControlsCount> controls = {};");
+    if (config.fullComments) CodeAppend(code, "    // Controls state (drawing order)");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppendFormat(code, "std::array<std::array<char, %i>, TextsCount> texts = {};", MAX_CONTROL_TEXT_LENGTH);
+    if (config.fullComments) CodeAppend(code, "    // TextBox controls text (drawing order)");
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "// Custom state variables (depend on development software)");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "// NOTE: This variables should be added manually if required");
+}
+
+// Write constexpr layout constructor code (.hpp), controls state initialization
+static void WriteConstexprConstructor(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    char layoutName[MAX_CODE_NAME_SIZE] = { 0 };
+    CodeTextToPascal(config.name, layoutName);
+
+    CodeAppendFormat(code, "constexpr Gui%sLayout()", layoutName);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code);
+
+    // Init controls state, only window boxes, toggles and text boxes require it
+    bool present[GUI_DUMMYREC + 1] = { 0 };
+    for (int i = 0; i < layout->controlCount; i++) present[layout->controls[i].type] = true;
+
+    bool textExist = present[GUI_TEXTBOX] || present[GUI_TEXTBOXMULTI];
+
+    if (present[GUI_WINDOWBOX] || present[GUI_TOGGLE] || textExist)
+    {
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "// Init controls state");
+            ENDLINEAPPEND(code);
+        }
+
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "for (std::size_t i = 0%s; i < ControlsCount; i++)", textExist? ", t = 0" : "");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code);
+
+        if (present[GUI_WINDOWBOX] || present[GUI_TOGGLE])
+        {
+            TABAPPEND(code, tabs + 2);
+            if (present[GUI_WINDOWBOX] && present[GUI_TOGGLE]) CodeAppendFormat(code, "if ((controlsData[i].type == %i) || (controlsData[i].type == %i)) controls[i].active = true;", GUI_WINDOWBOX, GUI_TOGGLE);
+            else CodeAppendFormat(code, "if (controlsData[i].type == %i) controls[i].active = true;", present[GUI_WINDOWBOX]? GUI_WINDOWBOX : GUI_TOGGLE);
+            ENDLINEAPPEND(code);
+        }
+        if (textExist)
+        {
+            TABAPPEND(code, tabs + 2);
+            CodeAppendFormat(code, "if ((controlsData[i].type == %i) || (controlsData[i].type == %i))", GUI_TEXTBOX, GUI_TEXTBOXMULTI);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+            CodeAppend(code, "{");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 3);
+            CodeAppendFormat(code, "for (std::size_t c = 0; (controlsData[i].text != nullptr) && (c < %i) && (controlsData[i].text[c] != '\\0'); c++) texts[t][c] = controlsData[i].text[c];", MAX_CONTROL_TEXT_LENGTH - 1);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 3);
+            CodeAppend(code, "t++;");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+            CodeAppend(code, "}");
+            ENDLINEAPPEND(code);
+        }
+
+        TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "// Custom variables initialization");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+}
+
+// Write constexpr layout drawing functions code (.hpp)
+// NOTE: Drawing function is instantiated per control (template), control type and data are resolved
+// at compile time (if constexpr), only present control types are written
+static void WriteConstexprFunctionDrawing(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
+{
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Draw layout controls");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppend(code, "void Draw()");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code);
+
+    if (layout->controlCount == 0)
+    {
+        TABAPPEND(code, tabs);
+        CodeAppend(code, "}");
+        return;
     }
 
-    ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
-    TextAppend(toolstr, "// Custom state variables (depend on development software)", pos);
-    ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
-    TextAppend(toolstr, "// NOTE: This variables should be added manually if required", pos);
+    int *order = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int *parent = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    GetControlsDrawOrder(layout, order, parent);
 
-    ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-    TextAppend(toolstr, TextFormat("} Gui%sState;", TextToPascal(config.name)), pos);
-}
+    bool present[GUI_DUMMYREC + 1] = { 0 };
+    for (int i = 0; i < layout->controlCount; i++) present[layout->controls[i].type] = true;
 
-// Write variables declaration code (.h)
-static void WriteFunctionsDeclarationH(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
-{
-    TextAppend(toolstr, TextFormat("Gui%sState InitGui%s(void);", TextToPascal(config.name), TextToPascal(config.name)), pos);
-    ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-    TextAppend(toolstr, TextFormat("void Gui%s(Gui%sState *state);", TextToPascal(config.name), TextToPascal(config.name)), pos);    
+    bool textExist = present[GUI_TEXTBOX] || present[GUI_TEXTBOXMULTI];
 
-    // Generate buttons functions declaration
-    if(config.exportButtonFunctions)
+    // If dropdown control exist, lock gui while any dropdown is in edit mode
+    if (present[GUI_DROPDOWNBOX])
     {
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-        WriteFunctionsDeclarationC(toolstr, pos, layout, config, tabs);
-    }   
-}
-
-// Write initialization function code (.h)
-static void WriteFunctionInitializeH(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
-{
-     // Export InitGuiLayout function definition
-    TextAppend(toolstr, TextFormat("Gui%sState InitGui%s(void)", TextToPascal(config.name), TextToPascal(config.name)), pos);
-    ENDLINEAPPEND(toolstr, pos);
-    TextAppend(toolstr, "{", pos);
-    ENDLINEAPPEND(toolstr, pos);
-    TABAPPEND(toolstr, pos, tabs + 1);
-    TextAppend(toolstr, TextFormat("Gui%sState state = { 0 };", TextToPascal(config.name)), pos);
-    ENDLINEAPPEND(toolstr, pos);
-    ENDLINEAPPEND(toolstr, pos);
-    TABAPPEND(toolstr, pos, tabs + 1);
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "// Lock gui while any dropdown is in edit mode");
+            ENDLINEAPPEND(code);
+        }
+        for (int k = 0; k < layout->controlCount; k++)
+        {
+            if (layout->controls[order[k]].type == GUI_DROPDOWNBOX)
+            {
+                TABAPPEND(code, tabs + 1);
+                CodeAppendFormat(code, "if (controls[%i].editMode) GuiLock();", k);
+                ENDLINEAPPEND(code);
+            }
+        }
+        ENDLINEAPPEND(code);
+    }
 
-    // Init anchors (forced on .h)
-    if (config.exportAnchors && (layout->anchorCount > 0)) WriteAnchors(toolstr, pos, layout, config, false, true, "state.", tabs + 1);
+    TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "DrawControls(std::make_index_sequence<ControlsCount>());");
+    ENDLINEAPPEND(code);
 
-    // Init controls variables
-    if (layout->controlCount > 0)
+    if (present[GUI_DROPDOWNBOX])
     {
-        WriteControlsVariables(toolstr, pos, layout, config, false, true, "state.", tabs + 1);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "GuiUnlock();");
+        ENDLINEAPPEND(code);
     }
 
-    // Define controls rectangles if required
-    if (config.defineRecs)
-    {
-        ENDLINEAPPEND(toolstr, pos);
-        ENDLINEAPPEND(toolstr, pos);
-        TABAPPEND(toolstr, pos, tabs + 1);
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 
-        // Define controls rectangles
+    // Control rectangle at anchor position, resolved at compile time for constant anchor
+    if (config.exportAnchors)
+    {
         if (config.fullComments)
         {
-            TextAppend(toolstr, "// Init controls rectangles", pos);
-            ENDLINEAPPEND(toolstr, pos);
-            TABAPPEND(toolstr, pos, tabs + 1);
+            CodeAppend(code, "// Get control rectangle at anchor position (compile time if anchor position is constant)");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
         }
+        CodeAppend(code, "static constexpr Rectangle GetControlRec(std::size_t index, Vector2 anchor)");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "return Rectangle{ controlsData[index].rec.x + anchor.x, controlsData[index].rec.y + anchor.y, controlsData[index].rec.width, controlsData[index].rec.height };");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
 
-        for (int k = 0; k < layout->controlCount; k++)
+    // Control editable text index, only used at compile time
+    if (textExist)
+    {
+        if (config.fullComments)
         {
-            TextAppend(toolstr, TextFormat("state.layoutRecs[%i] = ", k), pos);
-            WriteRectangleVariables(toolstr, pos, layout->controls[k], config.exportAnchors, config.fullComments, "state.", tabs, true);
-            ENDLINEAPPEND(toolstr, pos);
-            TABAPPEND(toolstr, pos, tabs + 1);
+            CodeAppend(code, "// Get control editable text index (TextBox controls, drawing order)");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
         }
-
-        *pos -= (tabs + 1)*4 + 1;
+        CodeAppend(code, "static constexpr std::size_t GetTextIndex(std::size_t index)");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "std::size_t count = 0;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "for (std::size_t i = 0; i < index; i++) if ((controlsData[i].type == %i) || (controlsData[i].type == %i)) count++;", GUI_TEXTBOX, GUI_TEXTBOXMULTI);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "return count;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
     }
 
-    ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
-    TextAppend(toolstr, "// Custom variables initialization", pos);
-    ENDLINEAPPEND(toolstr, pos);
+    // Controls drawing, one drawing function instantiated per control
+    CodeAppend(code, "private:");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "template <std::size_t... I>");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "void DrawControls(std::index_sequence<I...>)");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "(DrawControl<I>(), ...);");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 
-    // Return gui state after defining all its variables
-    ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
-    TextAppend(toolstr, "return state;", pos);
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Draw control, control type and data resolved at compile time");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+    CodeAppend(code, "template <std::size_t I>");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "void DrawControl()");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "constexpr ControlData data = controlsData[I];");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppend(code, "[[maybe_unused]] ControlState &control = controls[I];");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    if (config.exportAnchors) CodeAppend(code, "const Rectangle rec = GetControlRec(I, anchors[data.anchor]);");
+    else CodeAppend(code, "constexpr Rectangle rec = data.rec;");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+
+    if (present[GUI_WINDOWBOX])
+    {
+        if (config.fullComments)
+        {
+            TABAPPEND(code, tabs + 1);
+            CodeAppend(code, "// Skip closed window boxes and controls inside a closed window box");
+            ENDLINEAPPEND(code);
+        }
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "if constexpr (data.type == %i)", GUI_WINDOWBOX);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "if (!control.active) return;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "if constexpr (data.parent >= 0)");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "{");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "if (!controls[data.parent].active) return;");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "}");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code);
+    }
 
-    ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-    TextAppend(toolstr, "}", pos);
-    
-    // Generate buttons functions implementation
-    if(config.exportButtonFunctions)
+    bool first = true;
+    for (int type = 0; type <= GUI_DUMMYREC; type++)
     {
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-        WriteFunctionsDefinitionC(toolstr, pos, layout, config, tabs);
-    }  
-}
+        if (!present[type]) continue;
 
-// Write functions drawing code (.h)
-static void WriteFunctionDrawingH(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
-{
-    // Export GuiLayout draw function
-    TextAppend(toolstr, TextFormat("void Gui%s(Gui%sState *state)", TextToPascal(config.name), TextToPascal(config.name)), pos);
-    ENDLINEAPPEND(toolstr, pos);
-    TextAppend(toolstr, "{", pos);
-    ENDLINEAPPEND(toolstr, pos);
-    TABAPPEND(toolstr, pos, tabs + 1);
+        TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "%sif constexpr (data.type == %i) ", first? "" : "else ", type);
+        first = false;
 
-    // Const text
-    if (config.defineTexts) WriteConstText(toolstr, pos, layout, config, tabs + 1);
+        switch (type)
+        {
+            case GUI_WINDOWBOX: CodeAppend(code, "control.active = !GuiWindowBox(rec, data.text);"); break;
+            case GUI_GROUPBOX: CodeAppend(code, "GuiGroupBox(rec, data.text);"); break;
+            case GUI_LINE: CodeAppend(code, "GuiLine(rec, data.text);"); break;
+            case GUI_PANEL: CodeAppend(code, "GuiPanel(rec, data.text);"); break;
+            case GUI_LABEL: CodeAppend(code, "GuiLabel(rec, data.text);"); break;
+            case GUI_BUTTON: CodeAppend(code, "control.active = GuiButton(rec, data.text);"); break;
+            case GUI_LABELBUTTON: CodeAppend(code, "control.active = GuiLabelButton(rec, data.text);"); break;
+            case GUI_CHECKBOX: CodeAppend(code, "GuiCheckBox(rec, data.text, &control.active);"); break;
+            case GUI_TOGGLE: CodeAppend(code, "GuiToggle(rec, data.text, &control.active);"); break;
+            case GUI_TOGGLEGROUP: CodeAppend(code, "GuiToggleGroup(rec, data.text, &control.value);"); break;
+            case GUI_COMBOBOX: CodeAppend(code, "GuiComboBox(rec, data.text, &control.value);"); break;
+            case GUI_DROPDOWNBOX: CodeAppend(code, "{ if (GuiDropdownBox(rec, data.text, &control.value, control.editMode)) control.editMode = !control.editMode; }"); break;
+            case GUI_TEXTBOX: CodeAppendFormat(code, "{ if (GuiTextBox(rec, texts[GetTextIndex(I)].data(), %i, control.editMode)) control.editMode = !control.editMode; }", MAX_CONTROL_TEXT_LENGTH); break;
+            case GUI_TEXTBOXMULTI: CodeAppendFormat(code, "{ if (GuiTextBoxMulti(rec, texts[GetTextIndex(I)].data(), %i, control.editMode)) control.editMode = !control.editMode; }", MAX_CONTROL_TEXT_LENGTH); break;
+            case GUI_VALUEBOX: CodeAppend(code, "{ if (GuiValueBox(rec, data.text, &control.value, 0, 100, control.editMode)) control.editMode = !control.editMode; }"); break;
+            case GUI_SPINNER: CodeAppend(code, "{ if (GuiSpinner(rec, data.text, &control.value, 0, 100, control.editMode)) control.editMode = !control.editMode; }"); break;
+            case GUI_SLIDER: CodeAppend(code, "GuiSlider(rec, data.text, nullptr, &control.valuef, 0, 100);"); break;
+            case GUI_SLIDERBAR: CodeAppend(code, "GuiSliderBar(rec, data.text, nullptr, &control.valuef, 0, 100);"); break;
+            case GUI_PROGRESSBAR: CodeAppend(code, "GuiProgressBar(rec, data.text, nullptr, &control.valuef, 0, 1);"); break;
+            case GUI_STATUSBAR: CodeAppend(code, "GuiStatusBar(rec, data.text);"); break;
+            case GUI_SCROLLPANEL: CodeAppend(code, "GuiScrollPanel(Rectangle{ rec.x, rec.y, rec.width - control.boundsOffset.x, rec.height - control.boundsOffset.y }, data.text, rec, &control.scrollOffset, &control.scrollView);"); break;
+            case GUI_LISTVIEW: CodeAppend(code, "GuiListView(rec, data.text, &control.scrollIndex, &control.value);"); break;
+            case GUI_COLORPICKER: CodeAppend(code, "GuiColorPicker(rec, data.text, &control.color);"); break;
+            case GUI_DUMMYREC: CodeAppend(code, "GuiDummyRec(rec, data.text);"); break;
+            default: break;
+        }
 
-    // Controls draw
-    if (layout->controlCount > 0) WriteControlsDrawing(toolstr, pos, layout, config, "state->", tabs + 1);
+        if (config.fullComments)
+        {
+            TABAPPEND(code, 1);
+            CodeAppendFormat(code, "// %s", controlTypeName[type]);
+        }
+        ENDLINEAPPEND(code);
+    }
 
-    ENDLINEAPPEND(toolstr, pos);
-    TextAppend(toolstr, "}", pos);
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+
+    RL_FREE(order);
+    RL_FREE(parent);
 }
 
 //----------------------------------------------------------------------------------
@@ -506,76 +2183,73 @@ static void WriteFunctionDrawingH(char *toolstr, int *pos, GuiLayout *layout, Gu
 //----------------------------------------------------------------------------------
 
 // Write rectangle variables code (.c/.h)
-static void WriteRectangleVariables(char *toolstr, int *pos, GuiLayoutControl control, bool exportAnchors, bool fullComments, const char *preText, int tabs, bool exportH)
+static void WriteRectangleVariables(CodeBuilder *code, const GuiLayout *layout, int index, Vector2 offset, bool exportAnchors, bool fullComments, const char *preText, int tabs, bool exportH)
 {
-    if (exportAnchors && control.ap->id > 0)
-    {
-        TextAppend(toolstr, TextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height), pos);
-    }
-    else
-    {
-        if (control.ap->id > 0) TextAppend(toolstr, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, (int)control.rec.height), pos);
-        else TextAppend(toolstr, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, (int)control.rec.height), pos);
-    }
+    char rec[MAX_CODE_REC_SIZE] = { 0 };
+    GuiLayoutControl control = layout->controls[index];
+    GuiLayoutControlInfo info = layout->controlsInfo[index];
 
-    if (exportH) TextAppend(toolstr, ";", pos);
-    else  TextAppend(toolstr, ",", pos);
+    CodeAppend(code, GetControlRectangleText(layout, index, offset, false, exportAnchors, preText, rec));
+
+    if (exportH) CodeAppend(code, ";");
+    else  CodeAppend(code, ",");
 
     if (fullComments)
     {
-        TABAPPEND(toolstr, pos, tabs);
-        TextAppend(toolstr, TextFormat("// %s: %s",controlTypeName[control.type], control.name), pos);
+        TABAPPEND(code, tabs);
+        CodeAppendFormat(code, "// %s: %s",controlTypeName[control.type], GetLayoutString(layout, info.name));
     }
 }
 
 // Write anchors code (.c/.h)
-static void WriteAnchors(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, bool define, bool initialize, const char *preText, int tabs)
+static void WriteAnchors(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, bool define, bool initialize, const char *preText, int tabs)
 {
     if (config.fullComments)
     {
-        if (define) TextAppend(toolstr, "// Define anchors", pos);
-        else if (initialize) TextAppend(toolstr, "// Init anchors", pos);
-        ENDLINEAPPEND(toolstr, pos);
-        TABAPPEND(toolstr, pos, tabs);
+        if (define) CodeAppend(code, "// Define anchors");
+        else if (initialize) CodeAppend(code, "// Init anchors");
+        ENDLINEAPPEND(code);
+        TABAPPEND(code, tabs);
     }
 
-    for (int i = 1; i < MAX_ANCHOR_POINTS; i++)
+    for (int i = 1; i < layout->anchorCapacity; i++)
     {
         GuiAnchorPoint anchor = layout->anchors[i];
 
         if (anchor.enabled)
         {
-            if (define) TextAppend(toolstr, "Vector2 ", pos);
-            else TextAppend(toolstr, TextFormat("%s", preText), pos);
-            TextAppend(toolstr, TextFormat("%s", anchor.name), pos);
+            if (define) CodeAppend(code, "Vector2 ");
+            else CodeAppendFormat(code, "%s", preText);
+            CodeAppendFormat(code, "%s", anchor.name);
             if (initialize)
             {
-                TextAppend(toolstr, " = ", pos);
-                if(!define) TextAppend(toolstr, "(Vector2)", pos);
-                TextAppend(toolstr, TextFormat("{ %i, %i }", (int)layout->anchors[i].x, (int)layout->anchors[i].y), pos);
+                CodeAppend(code, " = ");
+                if(!define) CodeAppend(code, "(Vector2)");
+                GuiAnchorPoint position = GetCodeAnchor(layout, i, offset);
+                CodeAppendFormat(code, "{ %i, %i }", position.x, position.y);
             }
-            TextAppend(toolstr, ";", pos);
+            CodeAppend(code, ";");
 
             if (config.fullComments)
             {
-                TABAPPEND(toolstr, pos, 3);
-                TextAppend(toolstr, TextFormat("// ANCHOR ID:%i", anchor.id), pos);
+                TABAPPEND(code, 3);
+                CodeAppendFormat(code, "// ANCHOR ID:%i", anchor.id);
             }
 
-            ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
         }
     }
-    ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 }
 
 // Write controls "text as const" code (.c/.h)
-static void WriteConstText(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, int tabs)
+static void WriteConstText(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, int tabs)
 {
     // Const variables and define text
     if (config.fullComments)
     {
-        TextAppend(toolstr, "// Const text", pos);
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+        CodeAppend(code, "// Const text");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
     }
 
     bool drawConstText = false;
@@ -609,16 +2283,17 @@ static void WriteConstText(char *toolstr, int *pos, GuiLayout *layout, GuiLayout
             case GUI_COLORPICKER:
             {
                 // Skip constant text for elements with no text
-                if (layout->controls[i].text[0] == '\0') continue;
+                if (layout->controlsInfo[i].text.length == 0) continue;
 
-                TextAppend(toolstr, TextFormat("const char *%sText = \"%s\";", layout->controls[i].name, layout->controls[i].text), pos);
+                CodeAppendFormat(code, "const char *%sText = \"%s\";", GetLayoutString(layout, layout->controlsInfo[i].name), GetLayoutString(layout, layout->controlsInfo[i].text));
                 if (config.fullComments)
                 {
-                    TABAPPEND(toolstr, pos, 1);
-                    TextAppend(toolstr, TextFormat("// %s: %s", TextToUpper(controlTypeName[layout->controls[i].type]), layout->controls[i].name), pos);
+                    char typeName[MAX_CODE_NAME_SIZE] = { 0 };
+                    TABAPPEND(code, 1);
+                    CodeAppendFormat(code, "// %s: %s", CodeTextToUpper(controlTypeName[layout->controls[i].type], typeName), GetLayoutString(layout, layout->controlsInfo[i].name));
                 }
-                ENDLINEAPPEND(toolstr, pos);
-                TABAPPEND(toolstr, pos, tabs);
+                ENDLINEAPPEND(code);
+                TABAPPEND(code, tabs);
                 drawConstText = true;
                 
             } break;
@@ -626,197 +2301,198 @@ static void WriteConstText(char *toolstr, int *pos, GuiLayout *layout, GuiLayout
         }
     }
 
-    if (drawConstText) ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+    if (drawConstText) ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 }
 
 // Write controls variables code (.c/.h)
-static void WriteControlsVariables(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, bool define, bool initialize, const char *preText, int tabs)
+static void WriteControlsVariables(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, bool define, bool initialize, const char *preText, int tabs)
 {
     if (config.fullComments)
     {
-        if (define) TextAppend(toolstr, "// Define controls variables", pos);
-        else if (initialize) TextAppend(toolstr, "// Initilize controls variables", pos);
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+        if (define) CodeAppend(code, "// Define controls variables");
+        else if (initialize) CodeAppend(code, "// Initilize controls variables");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
     }
 
     for (int i = 0; i < layout->controlCount; i++)
     {
         bool drawVariables = true;
         GuiLayoutControl control = layout->controls[i];
+        GuiLayoutControlInfo info = layout->controlsInfo[i];
 
         switch (control.type)
         {
             case GUI_WINDOWBOX:
             {
-                if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = true", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "bool ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sActive", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = true");
+                CodeAppend(code, ";");
             } break;
             case GUI_BUTTON:
             case GUI_LABELBUTTON:
             {
                 if(!config.exportButtonFunctions)
                 {
-                    if (define) TextAppend(toolstr, "bool ", pos);
-                    else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                    TextAppend(toolstr, TextFormat("%sPressed", control.name), pos);
-                    if (initialize) TextAppend(toolstr, " = false", pos);
-                    TextAppend(toolstr, ";", pos);
+                    if (define) CodeAppend(code, "bool ");
+                    else CodeAppendFormat(code, "%s", preText);
+                    CodeAppendFormat(code, "%sPressed", GetLayoutString(layout, info.name));
+                    if (initialize) CodeAppend(code, " = false");
+                    CodeAppend(code, ";");
                 }
                 else drawVariables = false;
             } break;
             case GUI_CHECKBOX:
             {
-                if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sChecked", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = false", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "bool ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sChecked", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = false");
+                CodeAppend(code, ";");
             } break;
             case GUI_TOGGLE:
             {
-                if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = true", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "bool ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sActive", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = true");
+                CodeAppend(code, ";");
             } break;
             case GUI_TOGGLEGROUP:
             case GUI_COMBOBOX:
             {
-                if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = 0", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "int ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sActive", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = 0");
+                CodeAppend(code, ";");
             } break;
             case GUI_LISTVIEW:
             {
-                if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sScrollIndex", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = 0", pos);
-                TextAppend(toolstr, ";", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                if (define) CodeAppend(code, "int ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sScrollIndex", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = 0");
+                CodeAppend(code, ";");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
                 
-                if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = 0", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "int ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sActive", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = 0");
+                CodeAppend(code, ";");
             } break;
             case GUI_DROPDOWNBOX:
             {
-                if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sEditMode", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = false", pos);
-                TextAppend(toolstr, ";", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-
-                if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sActive", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = 0", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "bool ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sEditMode", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = false");
+                CodeAppend(code, ";");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+                if (define) CodeAppend(code, "int ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sActive", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = 0");
+                CodeAppend(code, ";");
             } break;
             case GUI_TEXTBOX:
             case GUI_TEXTBOXMULTI:
             {
-                if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sEditMode", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = false", pos);
-                TextAppend(toolstr, ";", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                if (define) CodeAppend(code, "bool ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sEditMode", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = false");
+                CodeAppend(code, ";");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 
                 if (define)
                 {
-                    TextAppend(toolstr, TextFormat("char %sText[%i]", control.name, MAX_CONTROL_TEXT_LENGTH), pos);
-                    if (initialize) TextAppend(toolstr, TextFormat(" = \"%s\"", control.text), pos);
+                    CodeAppendFormat(code, "char %sText[%i]", GetLayoutString(layout, info.name), MAX_CONTROL_TEXT_LENGTH);
+                    if (initialize) CodeAppendFormat(code, " = \"%s\"", GetLayoutString(layout, info.text));
                 }
-                else if (initialize) TextAppend(toolstr, TextFormat("strcpy(%s%sText, \"%s\")", preText, control.name, control.text), pos);
-                TextAppend(toolstr, ";", pos);
+                else if (initialize) CodeAppendFormat(code, "strcpy(%s%sText, \"%s\")", preText, GetLayoutString(layout, info.name), GetLayoutString(layout, info.text));
+                CodeAppend(code, ";");
 
             } break;
             case GUI_VALUEBOX:
             case GUI_SPINNER:
             {
-                if (define) TextAppend(toolstr, "bool ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sEditMode", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = false", pos);
-                TextAppend(toolstr, ";", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-
-                if (define) TextAppend(toolstr, "int ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sValue", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = 0", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "bool ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sEditMode", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = false");
+                CodeAppend(code, ";");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+                if (define) CodeAppend(code, "int ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sValue", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = 0");
+                CodeAppend(code, ";");
 
             } break;
             case GUI_SLIDER:
             case GUI_SLIDERBAR:
             case GUI_PROGRESSBAR:
             {
-                if (define) TextAppend(toolstr, "float ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sValue", control.name), pos);
-                if (initialize) TextAppend(toolstr, " = 0.0f", pos);
-                TextAppend(toolstr, ";", pos);
+                if (define) CodeAppend(code, "float ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sValue", GetLayoutString(layout, info.name));
+                if (initialize) CodeAppend(code, " = 0.0f");
+                CodeAppend(code, ";");
             } break;
             case GUI_COLORPICKER:
             {
-                if (define) TextAppend(toolstr, "Color ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sValue", control.name), pos);
+                if (define) CodeAppend(code, "Color ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sValue", GetLayoutString(layout, info.name));
                 if (initialize)
                 {
-                    TextAppend(toolstr, " = ", pos);
-                    if (!define) TextAppend(toolstr, "(Color)", pos);
-                    TextAppend(toolstr, "{ 0, 0, 0, 0 }", pos);
+                    CodeAppend(code, " = ");
+                    if (!define) CodeAppend(code, "(Color)");
+                    CodeAppend(code, "{ 0, 0, 0, 0 }");
                 }
-                TextAppend(toolstr, ";", pos);
+                CodeAppend(code, ";");
             } break;
             case GUI_SCROLLPANEL:
             {
-                if (define) TextAppend(toolstr, "Rectangle ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sScrollView", control.name), pos);
+                if (define) CodeAppend(code, "Rectangle ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sScrollView", GetLayoutString(layout, info.name));
                 if (initialize)
                 {
-                    TextAppend(toolstr, " = ", pos);
-                    if (!define) TextAppend(toolstr, "(Rectangle)", pos);
-                    TextAppend(toolstr, "{ 0, 0, 0, 0 }", pos);
+                    CodeAppend(code, " = ");
+                    if (!define) CodeAppend(code, "(Rectangle)");
+                    CodeAppend(code, "{ 0, 0, 0, 0 }");
                 }
-                TextAppend(toolstr, ";", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                CodeAppend(code, ";");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 
-                if (define) TextAppend(toolstr, "Vector2 ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sScrollOffset", control.name), pos);
+                if (define) CodeAppend(code, "Vector2 ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sScrollOffset", GetLayoutString(layout, info.name));
                 if (initialize)
                 {
-                    TextAppend(toolstr, " = ", pos);
-                    if (!define) TextAppend(toolstr, "(Vector2)", pos);
-                    TextAppend(toolstr, "{ 0, 0 }", pos);
+                    CodeAppend(code, " = ");
+                    if (!define) CodeAppend(code, "(Vector2)");
+                    CodeAppend(code, "{ 0, 0 }");
                 }
-                TextAppend(toolstr, ";", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                CodeAppend(code, ";");
+                ENDLINEAPPEND(code); TABAPPEND(code, tabs);
 
-                if (define) TextAppend(toolstr, "Vector2 ", pos);
-                else TextAppend(toolstr, TextFormat("%s", preText), pos);
-                TextAppend(toolstr, TextFormat("%sBoundsOffset", control.name), pos);
+                if (define) CodeAppend(code, "Vector2 ");
+                else CodeAppendFormat(code, "%s", preText);
+                CodeAppendFormat(code, "%sBoundsOffset", GetLayoutString(layout, info.name));
                 if (initialize)
                 {
-                    TextAppend(toolstr, " = ", pos);
-                    if (!define) TextAppend(toolstr, "(Vector2)", pos);
-                    TextAppend(toolstr, "{ 0, 0 }", pos);
+                    CodeAppend(code, " = ");
+                    if (!define) CodeAppend(code, "(Vector2)");
+                    CodeAppend(code, "{ 0, 0 }");
                 }
-                TextAppend(toolstr, ";", pos);
+                CodeAppend(code, ";");
             } break;
             case GUI_GROUPBOX:
             case GUI_LINE:
@@ -834,27 +2510,41 @@ static void WriteControlsVariables(char *toolstr, int *pos, GuiLayout *layout, G
         {
             if (config.fullComments)
             {
-                TABAPPEND(toolstr, pos, 3);
-                TextAppend(toolstr, TextFormat("// %s: %s", controlTypeName[layout->controls[i].type], layout->controls[i].name), pos);
+                TABAPPEND(code, 3);
+                CodeAppendFormat(code, "// %s: %s", controlTypeName[layout->controls[i].type], GetLayoutString(layout, layout->controlsInfo[i].name));
             }
-            ENDLINEAPPEND(toolstr, pos);
-            TABAPPEND(toolstr, pos, tabs);
+            ENDLINEAPPEND(code);
+            TABAPPEND(code, tabs);
         }
     }
-    *pos -= tabs*4 + 1; // Remove last \n\t
+    CodeRemove(code, tabs*4 + 1); // Remove last \n\t
 }
 
 // Write controls drawing code (full block) (.c/.h)
-static void WriteControlsDrawing(char *toolstr, int *pos, GuiLayout *layout, GuiLayoutConfig config, const char *preText, int tabs)
+static void WriteControlsDrawing(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const char *preText, int tabs)
 {
-    if (config.fullComments)
+    int *order = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int *parent = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    GetControlsDrawOrder(layout, order, parent);
+
+    // Static controls cached into render textures (one per group), rendered only on style change
+    // NOTE: Every group is drawn (render texture) in place of its first control, other group controls are skipped,
+    // group controls are consecutive in drawing order so controls z-order is kept
+    int *group = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+    int groupCount = GetCodeStaticControls(layout, config, group);
+    bool *groupDrawn = (bool *)RL_CALLOC(groupCount + 1, sizeof(bool));
+
+    if (groupCount > 0)
     {
-        TextAppend(toolstr, "// Draw controls", pos);
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+        WriteStaticControlsRendering(code, layout, config, offset, order, group, groupCount, preText, tabs);
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
     }
 
-    bool *draw = (bool *)RL_CALLOC(layout->controlCount, sizeof(bool));
-    for (int i = 0; i < layout->controlCount; i++) draw[i] = false;
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Draw controls");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
 
     // If dropdown control exist, draw GuiLock condition
     bool dropDownExist = false;
@@ -865,189 +2555,508 @@ static void WriteControlsDrawing(char *toolstr, int *pos, GuiLayout *layout, Gui
             if (!dropDownExist)
             {
                 dropDownExist = true;
-                TextAppend(toolstr, "if (", pos);
+                CodeAppend(code, "if (");
             }
             else
             {
-                TextAppend(toolstr, " || ", pos);
+                CodeAppend(code, " || ");
             }
-            TextAppend(toolstr, TextFormat("%sEditMode", GetControlNameParam(layout->controls[i].name, preText)), pos);
+            CodeAppendFormat(code, "%s%sEditMode", preText, GetLayoutString(layout, layout->controlsInfo[i].name));
         }
     }
 
     if (dropDownExist)
     {
-        TextAppend(toolstr, ") GuiLock();", pos);
-        ENDLINEAPPEND(toolstr, pos); ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+        CodeAppend(code, ") GuiLock();");
+        ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
     }
 
-    // Draw GUI_WINDOWBOX
-    for (int i = 0; i < layout->controlCount; i++)
+    for (int k = 0; k < layout->controlCount; k++)
     {
-        if (!draw[i])
-        {
-            if (layout->controls[i].type == GUI_WINDOWBOX)
-            {
-                draw[i] = true;
+        int i = order[k];
 
-                //char *rec = GetControlRectangleText(i, layout->controls[i], config.defineRecs, config.exportAnchors, preText);
-
-                TextAppend(toolstr, TextFormat("if (%sActive)", GetControlNameParam(layout->controls[i].name, preText)), pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-                TextAppend(toolstr, "{", pos);
+        if (layout->controls[i].type == GUI_WINDOWBOX)
+        {
+            CodeAppendFormat(code, "if (%s%sActive)", preText, GetLayoutString(layout, layout->controlsInfo[i].name));
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+            CodeAppend(code, "{");
 
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs + 1);
-                WriteControlDraw(toolstr, pos, i, layout->controls[i], config, preText); // Draw GUI_WINDOWBOX
-                ENDLINEAPPEND(toolstr, pos);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+            WriteControlDraw(code, layout, i, layout->controls[i], config, offset, preText); // Draw GUI_WINDOWBOX
+            ENDLINEAPPEND(code);
 
-                int windowAnchorID = layout->controls[i].ap->id;
+            // Draw controls inside window (first, and then GUI_DROPDOWNBOX inside GUI_WINDOWBOX)
+            while (((k + 1) < layout->controlCount) && (parent[order[k + 1]] == i))
+            {
+                int j = order[++k];
 
-                // Draw controls inside window
-                for (int j = 0; j < layout->controlCount; j++)
+                if (group[j] < 0)
                 {
-                    if (!draw[j] && i != j && layout->controls[j].type != GUI_WINDOWBOX  && layout->controls[j].type != GUI_DROPDOWNBOX)
-                    {
-                        if (windowAnchorID == layout->controls[j].ap->id)
-                        {
-                            draw[j] = true;
-
-                            TABAPPEND(toolstr, pos, tabs + 1);
-                            WriteControlDraw(toolstr, pos, j, layout->controls[j], config, preText);
-                            ENDLINEAPPEND(toolstr, pos);
-                        }
-                    }
+                    TABAPPEND(code, tabs + 1);
+                    WriteControlDraw(code, layout, j, layout->controls[j], config, offset, preText);
+                    ENDLINEAPPEND(code);
                 }
-
-                // Draw GUI_DROPDOWNBOX inside GUI_WINDOWBOX
-                for (int j = 0; j < layout->controlCount; j++)
+                else if (!groupDrawn[group[j]])
                 {
-                    if (!draw[j] && i != j && layout->controls[j].type == GUI_DROPDOWNBOX)
-                    {
-                        if (windowAnchorID == layout->controls[j].ap->id)
-                        {
-                            draw[j] = true;
-
-                            TABAPPEND(toolstr, pos, tabs + 1);
-                            WriteControlDraw(toolstr, pos, j, layout->controls[j], config, preText);
-                            ENDLINEAPPEND(toolstr, pos);
-                        }
-                    }
+                    TABAPPEND(code, tabs + 1);
+                    WriteStaticControlsBlit(code, layout, config, offset, order, group, group[j], preText);
+                    ENDLINEAPPEND(code);
+                    groupDrawn[group[j]] = true;
                 }
-                TABAPPEND(toolstr, pos, tabs);
-                TextAppend(toolstr, "}", pos);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
             }
+
+            TABAPPEND(code, tabs);
+            CodeAppend(code, "}");
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        }
+        else if (group[i] < 0)
+        {
+            WriteControlDraw(code, layout, i, layout->controls[i], config, offset, preText);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        }
+        else if (!groupDrawn[group[i]])
+        {
+            WriteStaticControlsBlit(code, layout, config, offset, order, group, group[i], preText);
+            ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+            groupDrawn[group[i]] = true;
         }
     }
 
-    // Draw the rest of controls except dropdownbox
-    for (int i = 0; i < layout->controlCount; i++)
+    if (dropDownExist)
+    {
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "GuiUnlock();");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+
+    CodeRemove(code, (tabs)*4 + 1); // Delete last tabs and \n
+
+    RL_FREE(order);
+    RL_FREE(parent);
+    RL_FREE(group);
+    RL_FREE(groupDrawn);
+}
+
+// Write control drawing code (individual controls) (.c/.h)
+static void WriteControlDraw(CodeBuilder *code, const GuiLayout *layout, int index, GuiLayoutControl control, GuiLayoutConfig config, Vector2 offset, const char *preText)
+{
+    GuiLayoutControlInfo info = layout->controlsInfo[index];
+
+    char rec[MAX_CODE_REC_SIZE] = { 0 };
+    char text[MAX_CODE_REC_SIZE] = { 0 };
+    char name[MAX_CODE_NAME_SIZE] = { 0 };
+    char functionName[MAX_CODE_NAME_SIZE] = { 0 };
+
+    GetControlRectangleText(layout, index, offset, config.defineRecs, config.exportAnchors, preText, rec);
+    GetControlTextParam(layout, index, config.defineTexts, text);
+    GetControlNameParam(GetLayoutString(layout, info.name), preText, name);
+
+    // TODO: Define text for window, groupbox, buttons, toggles and dummyrecs
+    switch (control.type)
+    {
+        case GUI_WINDOWBOX: CodeAppendFormat(code, "%sActive = !GuiWindowBox(%s, %s);", name, rec, text); break;
+        case GUI_GROUPBOX: CodeAppendFormat(code, "GuiGroupBox(%s, %s);", rec, text); break;
+        case GUI_LINE: CodeAppendFormat(code, "GuiLine(%s, %s);", rec, text); break;
+        case GUI_PANEL: CodeAppendFormat(code, "GuiPanel(%s, %s);", rec, text); break;
+        case GUI_LABEL: CodeAppendFormat(code, "GuiLabel(%s, %s);", rec, text); break;
+        case GUI_BUTTON: 
+            if(!config.exportButtonFunctions) CodeAppendFormat(code, "%sPressed = GuiButton(%s, %s); ", name, rec, text); 
+            else CodeAppendFormat(code, "if (GuiButton(%s, %s)) %s(); ", rec, text, CodeTextToPascal(GetLayoutString(layout, info.name), functionName)); 
+            break;
+        case GUI_LABELBUTTON: 
+            if(!config.exportButtonFunctions) CodeAppendFormat(code, "%sPressed = GuiLabelButton(%s, %s);", name, rec, text);
+            else CodeAppendFormat(code, "if (GuiLabelButton(%s, %s)) %s();", rec, text, CodeTextToPascal(GetLayoutString(layout, info.name), functionName)); 
+            break;
+        case GUI_CHECKBOX: CodeAppendFormat(code, "GuiCheckBox(%s, %s, &%sChecked);", rec, text, name); break;
+        case GUI_TOGGLE: CodeAppendFormat(code, "GuiToggle(%s, %s, &%sActive);", rec, text, name); break;
+        case GUI_TOGGLEGROUP:CodeAppendFormat(code, "GuiToggleGroup(%s, %s, &%sActive);", rec, text, name); break;
+        case GUI_COMBOBOX: CodeAppendFormat(code, "GuiComboBox(%s, %s, &%sActive);", rec, text, name); break;
+        case GUI_DROPDOWNBOX: CodeAppendFormat(code, "if (GuiDropdownBox(%s, %s, &%sActive, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name); break;
+        case GUI_TEXTBOX: CodeAppendFormat(code, "if (GuiTextBox(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name); break;
+        case GUI_TEXTBOXMULTI: CodeAppendFormat(code, "if (GuiTextBoxMulti(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name); break;
+        case GUI_VALUEBOX: CodeAppendFormat(code, "if (GuiValueBox(%s, %s, &%sValue, 0, 100, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name); break;
+        case GUI_SPINNER: CodeAppendFormat(code, "if (GuiSpinner(%s, %s, &%sValue, 0, 100, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name); break;
+        case GUI_SLIDER: CodeAppendFormat(code, "GuiSlider(%s, %s, NULL, &%sValue, 0, 100);", rec, text, name); break;
+        case GUI_SLIDERBAR: CodeAppendFormat(code, "GuiSliderBar(%s, %s, NULL, &%sValue, 0, 100);", rec, text, name); break;
+        case GUI_PROGRESSBAR: CodeAppendFormat(code, "GuiProgressBar(%s, %s, NULL, &%sValue, 0, 1);", rec, text, name); break;
+        case GUI_STATUSBAR: CodeAppendFormat(code, "GuiStatusBar(%s, %s);", rec, text); break;
+        case GUI_SCROLLPANEL:
+        {
+            char containerRec[MAX_CODE_REC_SIZE] = { 0 };
+            GetScrollPanelContainerRecText(layout, index, offset, config.defineRecs, config.exportAnchors, preText, containerRec);
+            CodeAppendFormat(code, "GuiScrollPanel(%s, %s, %s, &%sScrollOffset, &%sScrollView);", containerRec, text, rec, name, name); break;
+        }
+        case GUI_LISTVIEW: CodeAppendFormat(code, "GuiListView(%s, %s, &%sScrollIndex, &%sActive);", rec, text, name, name); break;
+        case GUI_COLORPICKER: CodeAppendFormat(code, "GuiColorPicker(%s, %s, &%sValue);", rec, text, name); break;
+        case GUI_DUMMYREC: CodeAppendFormat(code, "GuiDummyRec(%s, %s);", rec, text); break;
+        default: break;
+    }
+}
+
+// Write static controls cache variables code (.c/.h): render textures (one per group) and style hash
+static void WriteStaticControlsVariables(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, bool initialize, int tabs)
+{
+    int groupCount = GetCodeStaticControls(layout, config, NULL);
+    if (groupCount == 0) return;
+
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    if (config.fullComments)
+    {
+        CodeAppend(code, "// Static controls cache (render textures and style hash at last render)");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+
+    CodeAppendFormat(code, "RenderTexture2D layoutStaticTargets[%i]%s;", groupCount, initialize? " = { 0 }" : "");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppendFormat(code, "unsigned int layoutStaticStyle%s;", initialize? " = 0" : "");
+}
+
+// Write static controls rendering code (.c/.h), every group rendered into its render texture
+// NOTE: Groups are rendered relative to its origin (anchor), so they are only re-rendered on style change,
+// style changes are detected by a hash of the properties used by static controls
+static void WriteStaticControlsRendering(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const int *order, const int *group, int groupCount, const char *preText, int tabs)
+{
+    if (config.fullComments)
     {
-        if (!draw[i])
+        CodeAppend(code, "// Render static controls into render textures, only on first frame or style change");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+        CodeAppend(code, "// NOTE: Style hash computed from DEFAULT, LABEL and STATUSBAR properties, gui state and font");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    }
+
+    CodeAppend(code, "unsigned int staticStyle = 2166136261u;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "for (int p = 0; p < 3*24; p++) staticStyle = (staticStyle ^ (unsigned int)GuiGetStyle((p < 24)? DEFAULT : ((p < 48)? LABEL : STATUSBAR), p%24))*16777619u;");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "staticStyle = (staticStyle ^ (unsigned int)GuiGetState() ^ (GuiGetFont().texture.id << 8))*16777619u;");
+    ENDLINEAPPEND(code); ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+
+    CodeAppendFormat(code, "if ((%slayoutStaticTargets[0].id == 0) || (staticStyle != %slayoutStaticStyle))", preText, preText);
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs);
+    CodeAppend(code, "{");
+    ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+    CodeAppendFormat(code, "%slayoutStaticStyle = staticStyle;", preText);
+    ENDLINEAPPEND(code);
+
+    for (int g = 0; g < groupCount; g++)
+    {
+        char originX[MAX_CODE_REC_SIZE] = { 0 };
+        char originY[MAX_CODE_REC_SIZE] = { 0 };
+        int width = 0;
+        int height = 0;
+        GetStaticGroupOrigin(layout, config, offset, order, group, g, preText, originX, originY, &width, &height);
+
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "if (%slayoutStaticTargets[%i].id == 0) %slayoutStaticTargets[%i] = LoadRenderTexture(%i, %i);", preText, g, preText, g, width, height);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppendFormat(code, "BeginTextureMode(%slayoutStaticTargets[%i]);", preText, g);
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "ClearBackground(BLANK);");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 2);
+        CodeAppendFormat(code, "BeginMode2D((Camera2D){ (Vector2){ -(%s), -(%s) }, (Vector2){ 0, 0 }, 0.0f, 1.0f });", originX, originY);
+        ENDLINEAPPEND(code);
+
+        for (int k = 0; k < layout->controlCount; k++)
         {
-            if (layout->controls[i].type != GUI_DROPDOWNBOX)
+            int i = order[k];
+
+            if (group[i] == g)
             {
-                draw[i] = true;
-                WriteControlDraw(toolstr, pos, i, layout->controls[i], config, preText);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                TABAPPEND(code, tabs + 3);
+                WriteControlDraw(code, layout, i, layout->controls[i], config, offset, preText);
+                ENDLINEAPPEND(code);
             }
         }
+
+        TABAPPEND(code, tabs + 2);
+        CodeAppend(code, "EndMode2D();");
+        ENDLINEAPPEND(code); TABAPPEND(code, tabs + 1);
+        CodeAppend(code, "EndTextureMode();");
+        ENDLINEAPPEND(code);
+    }
+
+    TABAPPEND(code, tabs);
+    CodeAppend(code, "}");
+}
+
+// Write static controls group drawing code (.c/.h), render texture drawn at group origin
+// NOTE: Render texture is flipped vertically (OpenGL coordinates)
+static void WriteStaticControlsBlit(CodeBuilder *code, const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const int *order, const int *group, int groupIndex, const char *preText)
+{
+    char originX[MAX_CODE_REC_SIZE] = { 0 };
+    char originY[MAX_CODE_REC_SIZE] = { 0 };
+    int width = 0;
+    int height = 0;
+    GetStaticGroupOrigin(layout, config, offset, order, group, groupIndex, preText, originX, originY, &width, &height);
+
+    CodeAppendFormat(code, "DrawTextureRec(%slayoutStaticTargets[%i].texture, (Rectangle){ 0, 0, %i, -%i }, (Vector2){ %s, %s }, WHITE);", preText, groupIndex, width, height, originX, originY);
+    if (config.fullComments) CodeAppend(code, "    // Static controls (cached)");
+}
+
+// Get controls drawing order: every window box followed by the controls linked to same anchor,
+// then the rest of controls and finally dropdowns, so dropdowns are drawn over other controls
+// NOTE: Controls linked to an anchor are drawn inside the first GUI_WINDOWBOX linked to same anchor,
+// parent is the window box (control index) drawing the control, -1 if not drawn inside a window box
+static void GetControlsDrawOrder(const GuiLayout *layout, int *order, int *parent)
+{
+    // Bucket controls by anchor and type class (regular, dropdown), keeping controls order
+    int anchorsCount = GetCodeAnchorsCount(layout);
+    int bucketCount = anchorsCount*2;               // Bucket: anchorId*2 + (dropdown? 1 : 0)
+    int *bucketStart = (int *)RL_CALLOC(bucketCount + 1, sizeof(int));
+    int *bucketNext = (int *)RL_CALLOC(bucketCount, sizeof(int));
+    int *bucketControls = (int *)RL_CALLOC(layout->controlCount + 1, sizeof(int));
+    int *anchorWindow = (int *)RL_CALLOC(anchorsCount, sizeof(int));     // First window on anchor (index + 1)
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        int type = layout->controls[i].type;
+        int anchorId = layout->controls[i].anchorId;
+
+        if (type == GUI_WINDOWBOX)
+        {
+            if (anchorWindow[anchorId] == 0) anchorWindow[anchorId] = i + 1;
+        }
+        else bucketStart[anchorId*2 + ((type == GUI_DROPDOWNBOX)? 1 : 0) + 1]++;
+    }
+
+    for (int k = 0; k < bucketCount; k++)
+    {
+        bucketStart[k + 1] += bucketStart[k];
+        bucketNext[k] = bucketStart[k];
+    }
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        int type = layout->controls[i].type;
+        if (type != GUI_WINDOWBOX) bucketControls[bucketNext[layout->controls[i].anchorId*2 + ((type == GUI_DROPDOWNBOX)? 1 : 0)]++] = i;
     }
 
-    // Draw GUI_DROPDOWNBOX
+    int count = 0;
+
+    // GUI_WINDOWBOX controls, followed by controls inside window (first, and then GUI_DROPDOWNBOX)
+    // NOTE: Both anchor buckets are contiguous: regular controls followed by dropdowns
     for (int i = 0; i < layout->controlCount; i++)
     {
-        if (!draw[i])
+        if (layout->controls[i].type == GUI_WINDOWBOX)
         {
-            if (layout->controls[i].type == GUI_DROPDOWNBOX)
+            int windowAnchorID = layout->controls[i].anchorId;
+
+            order[count++] = i;
+            parent[i] = -1;
+
+            if (anchorWindow[windowAnchorID] == (i + 1))
             {
-                draw[i] = true;
-                WriteControlDraw(toolstr, pos, i, layout->controls[i], config, preText);
-                ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+                for (int k = bucketStart[windowAnchorID*2]; k < bucketStart[windowAnchorID*2 + 2]; k++)
+                {
+                    order[count++] = bucketControls[k];
+                    parent[bucketControls[k]] = i;
+                }
             }
         }
     }
 
-    if (dropDownExist)
+    // The rest of controls except dropdownbox
+    for (int i = 0; i < layout->controlCount; i++)
     {
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
-        TextAppend(toolstr, "GuiUnlock();", pos);
-        ENDLINEAPPEND(toolstr, pos); TABAPPEND(toolstr, pos, tabs);
+        int type = layout->controls[i].type;
+
+        if ((type != GUI_WINDOWBOX) && (type != GUI_DROPDOWNBOX) && (anchorWindow[layout->controls[i].anchorId] == 0))
+        {
+            order[count++] = i;
+            parent[i] = -1;
+        }
     }
 
-    *pos -= (tabs)*4 + 1; // Delete last tabs and \n
+    // GUI_DROPDOWNBOX controls
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        if ((layout->controls[i].type == GUI_DROPDOWNBOX) && (anchorWindow[layout->controls[i].anchorId] == 0))
+        {
+            order[count++] = i;
+            parent[i] = -1;
+        }
+    }
 
-    RL_FREE(draw);
+    RL_FREE(bucketStart);
+    RL_FREE(bucketNext);
+    RL_FREE(bucketControls);
+    RL_FREE(anchorWindow);
 }
 
-// Write control drawing code (individual controls) (.c/.h)
-static void WriteControlDraw(char *toolstr, int *pos, int index, GuiLayoutControl control, GuiLayoutConfig config, const char *preText)
+// Get static controls cache groups: GroupBox, Line, Panel, Label and StatusBar controls, consecutive in drawing order
+// and linked to same anchor, group index is written into group array for every control (-1 if not cached), returns groups count
+// NOTE: Groups are numbered in drawing order, any other control (or anchor change) breaks current group,
+// so drawing a group in place of its first control keeps controls z-order
+static int GetCodeStaticControls(const GuiLayout *layout, GuiLayoutConfig config, int *group)
 {
-    char *rec = GetControlRectangleText(index, control, config.defineRecs, config.exportAnchors, preText);
-    char *text = GetControlTextParam(control, config.defineTexts);
-    char *name = GetControlNameParam(control.name, preText);
+    int groupCount = 0;
 
-    // TODO: Define text for window, groupbox, buttons, toggles and dummyrecs
-    switch (control.type)
+    if (group != NULL) for (int i = 0; i < layout->controlCount; i++) group[i] = -1;
+
+    if (config.cacheStaticControls && (layout->controlCount > 0))
     {
-        case GUI_WINDOWBOX: TextAppend(toolstr, TextFormat("%sActive = !GuiWindowBox(%s, %s);", name, rec, text), pos); break;
-        case GUI_GROUPBOX: TextAppend(toolstr, TextFormat("GuiGroupBox(%s, %s);", rec, text), pos); break;
-        case GUI_LINE: TextAppend(toolstr, TextFormat("GuiLine(%s, %s);", rec, text), pos); break;
-        case GUI_PANEL: TextAppend(toolstr, TextFormat("GuiPanel(%s, %s);", rec, text), pos); break;
-        case GUI_LABEL: TextAppend(toolstr, TextFormat("GuiLabel(%s, %s);", rec, text), pos); break;
-        case GUI_BUTTON: 
-            if(!config.exportButtonFunctions) TextAppend(toolstr, TextFormat("%sPressed = GuiButton(%s, %s); ", name, rec, text), pos); 
-            else TextAppend(toolstr, TextFormat("if (GuiButton(%s, %s)) %s(); ", rec, text, TextToPascal(control.name)), pos); 
-            break;
-        case GUI_LABELBUTTON: 
-            if(!config.exportButtonFunctions) TextAppend(toolstr, TextFormat("%sPressed = GuiLabelButton(%s, %s);", name, rec, text), pos);
-            else TextAppend(toolstr, TextFormat("if (GuiLabelButton(%s, %s)) %s();", rec, text, TextToPascal(control.name)), pos); 
-            break;
-        case GUI_CHECKBOX: TextAppend(toolstr, TextFormat("GuiCheckBox(%s, %s, &%sChecked);", rec, text, name), pos); break;
-        case GUI_TOGGLE: TextAppend(toolstr, TextFormat("GuiToggle(%s, %s, &%sActive);", rec, text, name), pos); break;
-        case GUI_TOGGLEGROUP:TextAppend(toolstr, TextFormat("GuiToggleGroup(%s, %s, &%sActive);", rec, text, name), pos); break;
-        case GUI_COMBOBOX: TextAppend(toolstr, TextFormat("GuiComboBox(%s, %s, &%sActive);", rec, text, name), pos); break;
-        case GUI_DROPDOWNBOX: TextAppend(toolstr, TextFormat("if (GuiDropdownBox(%s, %s, &%sActive, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name), pos); break;
-        case GUI_TEXTBOX: TextAppend(toolstr, TextFormat("if (GuiTextBox(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name), pos); break;
-        case GUI_TEXTBOXMULTI: TextAppend(toolstr, TextFormat("if (GuiTextBoxMulti(%s, %sText, %i, %sEditMode)) %sEditMode = !%sEditMode;", rec, name, MAX_CONTROL_TEXT_LENGTH, name, name, name), pos); break;
-        case GUI_VALUEBOX: TextAppend(toolstr, TextFormat("if (GuiValueBox(%s, %s, &%sValue, 0, 100, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name), pos); break;
-        case GUI_SPINNER: TextAppend(toolstr, TextFormat("if (GuiSpinner(%s, %s, &%sValue, 0, 100, %sEditMode)) %sEditMode = !%sEditMode;", rec, text, name, name, name, name), pos); break;
-        case GUI_SLIDER: TextAppend(toolstr, TextFormat("GuiSlider(%s, %s, NULL, &%sValue, 0, 100);", rec, text, name), pos); break;
-        case GUI_SLIDERBAR: TextAppend(toolstr, TextFormat("GuiSliderBar(%s, %s, NULL, &%sValue, 0, 100);", rec, text, name), pos); break;
-        case GUI_PROGRESSBAR: TextAppend(toolstr, TextFormat("GuiProgressBar(%s, %s, NULL, &%sValue, 0, 1);", rec, text, name), pos); break;
-        case GUI_STATUSBAR: TextAppend(toolstr, TextFormat("GuiStatusBar(%s, %s);", rec, text), pos); break;
-        case GUI_SCROLLPANEL:
+        int *order = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+        int *parent = (int *)RL_CALLOC(layout->controlCount, sizeof(int));
+        int groupAnchor = -1;           // Current group anchor, -1 if no group open
+        GetControlsDrawOrder(layout, order, parent);
+
+        for (int k = 0; k < layout->controlCount; k++)
         {
-            char *containerRec = GetScrollPanelContainerRecText(index, control, config.defineRecs, config.exportAnchors, preText);
-            TextAppend(toolstr, TextFormat("GuiScrollPanel(%s, %s, %s, &%sScrollOffset, &%sScrollView);", containerRec, text, rec, name, name), pos); break;
+            int i = order[k];
+            int type = layout->controls[i].type;
+
+            if ((type == GUI_GROUPBOX) || (type == GUI_LINE) || (type == GUI_PANEL) || (type == GUI_LABEL) || (type == GUI_STATUSBAR))
+            {
+                int anchorId = layout->controls[i].anchorId;
+
+                if (anchorId != groupAnchor)
+                {
+                    groupAnchor = anchorId;
+                    groupCount++;
+                }
+
+                if (group != NULL) group[i] = groupCount - 1;
+            }
+            else groupAnchor = -1;      // Interactive control drawn in between, next static control starts a new group
         }
-        case GUI_LISTVIEW: TextAppend(toolstr, TextFormat("GuiListView(%s, %s, &%sScrollIndex, &%sActive);", rec, (text == NULL)? "null" : text, name, name), pos); break;
-        case GUI_COLORPICKER: TextAppend(toolstr, TextFormat("GuiColorPicker(%s, %s, &%sValue);", rec, text, name), pos); break;
-        case GUI_DUMMYREC: TextAppend(toolstr, TextFormat("GuiDummyRec(%s, %s);", rec, text), pos); break;
-        default: break;
+
+        RL_FREE(order);
+        RL_FREE(parent);
+    }
+
+    return groupCount;
+}
+
+// Get static controls group origin code (top-left corner) and render texture size
+// NOTE: Origin texts are written into provided buffers (MAX_CODE_REC_SIZE), origin follows group anchor
+// (or first control rectangle if rectangles defined), bounds are extended by STATIC_CACHE_MARGIN on every side
+static void GetStaticGroupOrigin(const GuiLayout *layout, GuiLayoutConfig config, Vector2 offset, const int *order, const int *group, int groupIndex, const char *preText, char *originX, char *originY, int *width, int *height)
+{
+    int first = -1;
+    Rectangle firstRec = { 0 };
+    Rectangle bounds = { 0 };
+
+    for (int k = 0; k < layout->controlCount; k++)
+    {
+        int i = order[k];
+        if (group[i] != groupIndex) continue;
+
+        // Control rectangle as written in code: relative to anchor if anchors exported, absolute otherwise
+        GuiLayoutControl control = GetCodeControl(layout, i, offset);
+        GuiAnchorPoint anchor = GetCodeAnchor(layout, control.anchorId, offset);
+
+        if (!config.exportAnchors || (control.anchorId == 0))
+        {
+            if (control.anchorId > 0) { control.rec.x += anchor.x; control.rec.y += anchor.y; }
+            else { control.rec.x -= anchor.x; control.rec.y -= anchor.y; }
+        }
+
+        if (first < 0)
+        {
+            first = i;
+            firstRec = control.rec;
+            bounds = control.rec;
+        }
+        else
+        {
+            float right = fmaxf(bounds.x + bounds.width, control.rec.x + control.rec.width);
+            float bottom = fmaxf(bounds.y + bounds.height, control.rec.y + control.rec.height);
+            bounds.x = fminf(bounds.x, control.rec.x);
+            bounds.y = fminf(bounds.y, control.rec.y);
+            bounds.width = right - bounds.x;
+            bounds.height = bottom - bounds.y;
+        }
+    }
+
+    int x = (int)bounds.x - STATIC_CACHE_MARGIN;
+    int y = (int)bounds.y - STATIC_CACHE_MARGIN;
+    *width = (int)bounds.width + 2*STATIC_CACHE_MARGIN;
+    *height = (int)bounds.height + 2*STATIC_CACHE_MARGIN;
+
+    int anchorId = layout->controls[first].anchorId;
+
+    if (config.defineRecs)
+    {
+        int dx = x - (int)firstRec.x;
+        int dy = y - (int)firstRec.y;
+        snprintf(originX, MAX_CODE_REC_SIZE, "%slayoutRecs[%i].x %c %i", preText, first, (dx < 0)? '-' : '+', (dx < 0)? -dx : dx);
+        snprintf(originY, MAX_CODE_REC_SIZE, "%slayoutRecs[%i].y %c %i", preText, first, (dy < 0)? '-' : '+', (dy < 0)? -dy : dy);
+    }
+    else if (config.exportAnchors && (anchorId > 0))
+    {
+        const char *name = layout->anchors[anchorId].name;
+        snprintf(originX, MAX_CODE_REC_SIZE, "%s%s.x %c %i", preText, name, (x < 0)? '-' : '+', (x < 0)? -x : x);
+        snprintf(originY, MAX_CODE_REC_SIZE, "%s%s.y %c %i", preText, name, (y < 0)? '-' : '+', (y < 0)? -y : y);
+    }
+    else
+    {
+        snprintf(originX, MAX_CODE_REC_SIZE, "%i", x);
+        snprintf(originY, MAX_CODE_REC_SIZE, "%i", y);
+    }
+}
+
+// Get anchors count used by code: highest anchor id used (enabled anchors and controls) + 1
+// NOTE: Anchors array capacity is not used, generated code must not depend on layout growth policy
+static int GetCodeAnchorsCount(const GuiLayout *layout)
+{
+    int count = 1;
+
+    for (int i = 1; i < layout->anchorCapacity; i++) if (layout->anchors[i].enabled && (i >= count)) count = i + 1;
+    for (int i = 0; i < layout->controlCount; i++) if (layout->controls[i].anchorId >= count) count = layout->controls[i].anchorId + 1;
+
+    return count;
+}
+
+// Get anchor with position relative to reference window and code offset
+// NOTE: Layout is not modified, anchor 0 (reference window) is already implicit
+static GuiAnchorPoint GetCodeAnchor(const GuiLayout *layout, int anchorId, Vector2 offset)
+{
+    GuiAnchorPoint anchor = layout->anchors[anchorId];
+
+    if ((anchorId > 0) && anchor.enabled)
+    {
+        anchor.x -= (int)(layout->refWindow.x + offset.x);
+        anchor.y -= (int)(layout->refWindow.y + offset.y);
+    }
+
+    return anchor;
+}
+
+// Get control with rectangle relative to code offset
+// NOTE: Layout is not modified, only controls with no anchor are offset
+static GuiLayoutControl GetCodeControl(const GuiLayout *layout, int index, Vector2 offset)
+{
+    GuiLayoutControl control = layout->controls[index];
+
+    if (control.anchorId == 0)
+    {
+        control.rec.x -= offset.x;
+        control.rec.y -= offset.y;
     }
+
+    return control;
 }
 
 // Get controls rectangle text
-static char *GetControlRectangleText(int index, GuiLayoutControl control, bool defineRecs, bool exportAnchors, const char *preText)
+static char *GetControlRectangleText(const GuiLayout *layout, int index, Vector2 offset, bool defineRecs, bool exportAnchors, const char *preText, char *text)
 {
-    static char text[512];
-    memset(text, 0, 512);
+    GuiLayoutControl control = GetCodeControl(layout, index, offset);
+    GuiAnchorPoint anchor = GetCodeAnchor(layout, control.anchorId, offset);
 
     if (defineRecs)
     {
-        strcpy(text, TextFormat("%slayoutRecs[%i]", preText, index));
+        snprintf(text, MAX_CODE_REC_SIZE, "%slayoutRecs[%i]", preText, index);
     }
     else
     {
-        if (exportAnchors && control.ap->id > 0)
+        if (exportAnchors && control.anchorId > 0)
         {
-            strcpy(text, TextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height));
+            snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i, %i }", preText, anchor.name, (int)control.rec.x, preText, anchor.name, (int)control.rec.y, (int)control.rec.width, (int)control.rec.height);
         }
         else
         {
-            if (control.ap->id > 0) strcpy(text, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, (int)control.rec.height));
-            else strcpy(text, TextFormat("(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, (int)control.rec.height));
+            if (control.anchorId > 0) snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x + anchor.x, (int)control.rec.y + anchor.y, (int)control.rec.width, (int)control.rec.height);
+            else snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){ %i, %i, %i, %i }", (int)control.rec.x - anchor.x, (int)control.rec.y - anchor.y, (int)control.rec.width, (int)control.rec.height);
         }
     }
 
@@ -1055,26 +3064,27 @@ static char *GetControlRectangleText(int index, GuiLayoutControl control, bool d
 }
 
 // Get scroll panel container rectangle text
-static char *GetScrollPanelContainerRecText(int index, GuiLayoutControl control, bool defineRecs, bool exportAnchors, const char *preText)
+static char *GetScrollPanelContainerRecText(const GuiLayout *layout, int index, Vector2 offset, bool defineRecs, bool exportAnchors, const char *preText, char *text)
 {
-    static char text[512];
-    memset(text, 0, 512);
+    GuiLayoutControl control = GetCodeControl(layout, index, offset);
+    GuiAnchorPoint anchor = GetCodeAnchor(layout, control.anchorId, offset);
+    const char *name = GetLayoutString(layout, layout->controlsInfo[index].name);
 
     if(defineRecs)
     {
-        strcpy(text, TextFormat("(Rectangle){%slayoutRecs[%i].x, %slayoutRecs[%i].y, %slayoutRecs[%i].width - %s%sBoundsOffset.x, %slayoutRecs[%i].height - %s%sBoundsOffset.y }", preText, index, preText, index, preText, index, preText, control.name, preText, index, preText, control.name));
+        snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){%slayoutRecs[%i].x, %slayoutRecs[%i].y, %slayoutRecs[%i].width - %s%sBoundsOffset.x, %slayoutRecs[%i].height - %s%sBoundsOffset.y }", preText, index, preText, index, preText, index, preText, name, preText, index, preText, name);
     }
     else
     {
-        if (exportAnchors && control.ap->id > 0)
+        if (exportAnchors && control.anchorId > 0)
         {
-            strcpy(text, TextFormat("(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", preText, control.ap->name, (int)control.rec.x, preText, control.ap->name, (int)control.rec.y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
+            snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){ %s%s.x + %i, %s%s.y + %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", preText, anchor.name, (int)control.rec.x, preText, anchor.name, (int)control.rec.y, (int)control.rec.width, preText, name, (int)control.rec.height, preText, name);
         }
         else
         {
             // DOING
-            if (control.ap->id > 0) strcpy(text, TextFormat("(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", (int)control.rec.x + control.ap->x, (int)control.rec.y + control.ap->y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
-            else strcpy(text, TextFormat("(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y}", (int)control.rec.x - control.ap->x, (int)control.rec.y - control.ap->y, (int)control.rec.width, preText, control.name, (int)control.rec.height, preText, control.name));
+            if (control.anchorId > 0) snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y }", (int)control.rec.x + anchor.x, (int)control.rec.y + anchor.y, (int)control.rec.width, preText, name, (int)control.rec.height, preText, name);
+            else snprintf(text, MAX_CODE_REC_SIZE, "(Rectangle){ %i, %i, %i - %s%sBoundsOffset.x, %i - %s%sBoundsOffset.y}", (int)control.rec.x - anchor.x, (int)control.rec.y - anchor.y, (int)control.rec.width, preText, name, (int)control.rec.height, preText, name);
 
         }
     }
@@ -1083,36 +3093,72 @@ static char *GetScrollPanelContainerRecText(int index, GuiLayoutControl control,
 }
 
 // Get controls parameters text
-static char *GetControlTextParam(GuiLayoutControl control, bool defineText)
+static char *GetControlTextParam(const GuiLayout *layout, int index, bool defineText, char *text)
 {
-    static char text[512];
-    memset(text, 0, 512);
+    GuiLayoutControlInfo info = layout->controlsInfo[index];
 
     if (defineText) 
     {
         // Skip constant text for elements with no text
-        if (control.text[0] == '\0') strcpy(text, "NULL");
-        else strcpy(text, TextFormat("%sText", control.name));
+        if (info.text.length == 0) strcpy(text, "NULL");
+        else snprintf(text, MAX_CODE_REC_SIZE, "%sText", GetLayoutString(layout, info.name));
     }
     else 
     {
-        // NOTE: control.text will never be NULL
-        if (control.text[0] == '\0') strcpy(text, "NULL");
-        else strcpy(text, TextFormat("\"%s\"", control.text));
+        // NOTE: info.text will never be NULL
+        if (info.text.length == 0) strcpy(text, "NULL");
+        else snprintf(text, MAX_CODE_REC_SIZE, "\"%s\"", GetLayoutString(layout, info.text));
     }
 
     return text;
 }
 
 // Get controls name text
-static char *GetControlNameParam(char *controlName, const char *preText)
+static char *GetControlNameParam(const char *controlName, const char *preText, char *text)
 {
-    static char text[256];
-    memset(text, 0, 256);
-
-    strcpy(text, TextFormat("%s%s", preText, controlName));
+    snprintf(text, MAX_CODE_NAME_SIZE, "%s%s", preText, controlName);
 
     return text;
 }
 
+// Get text converted to uppercase
+static char *CodeTextToUpper(const char *text, char *buffer)
+{
+    int i = 0;
+    for (; (text[i] != '\0') && (i < (MAX_CODE_NAME_SIZE - 1)); i++) buffer[i] = (char)toupper((unsigned char)text[i]);
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
+// Get text converted to lowercase
+static char *CodeTextToLower(const char *text, char *buffer)
+{
+    int i = 0;
+    for (; (text[i] != '\0') && (i < (MAX_CODE_NAME_SIZE - 1)); i++) buffer[i] = (char)tolower((unsigned char)text[i]);
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
+// Get text converted to PascalCase, underscores are removed and next character uppercased
+static char *CodeTextToPascal(const char *text, char *buffer)
+{
+    int i = 0;
+    bool upper = true;
+
+    for (int j = 0; (text[j] != '\0') && (i < (MAX_CODE_NAME_SIZE - 1)); j++)
+    {
+        if (text[j] == '_') upper = true;
+        else
+        {
+            buffer[i++] = upper? (char)toupper((unsigned char)text[j]) : text[j];
+            upper = false;
+        }
+    }
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
 #endif // CODEGEN_IMPLEMENTATION
\ No newline at end of file
@@ -61,6 +61,7 @@ typedef struct {
     bool defineTextsChecked;
     bool fullCommentsChecked;
     bool genButtonFuncsChecked;
+    bool cacheStaticChecked;
 
     bool btnExportCodePressed;
     //bool btnExecuteCodePressed;
@@ -148,6 +149,7 @@ GuiWindowCodegenState InitGuiWindowCodegen(void)
     state.defineTextsChecked = false;
     state.fullCommentsChecked = false;
     state.genButtonFuncsChecked = false;
+    state.cacheStaticChecked = false;
 
     state.btnExportCodePressed = false;
     state.btnLoadCustomTemplatePressed = false;
@@ -182,23 +184,24 @@ void GuiWindowCodegen(GuiWindowCodegenState *state)
         GuiLabel((Rectangle){ state->windowBounds.x + 775, state->windowBounds.y + 148, 160, 24 }, "Short Description:");
         if (GuiTextBox((Rectangle){ state->windowBounds.x + 775, state->windowBounds.y + 172, 228, 28 }, state->toolDescriptionText, 64, state->toolDescriptionEditMode)) state->toolDescriptionEditMode = !state->toolDescriptionEditMode;
         
-        GuiGroupBox((Rectangle){ state->windowBounds.x + 765, state->windowBounds.y + 236, 248, 226 }, "#142#Code Generation Options");
+        GuiGroupBox((Rectangle){ state->windowBounds.x + 765, state->windowBounds.y + 236, 248, 250 }, "#142#Code Generation Options");
         GuiCheckBox((Rectangle){ state->windowBounds.x + 785, state->windowBounds.y + 292, 16, 16 }, "Export anchors", &state->exportAnchorsChecked);
         GuiCheckBox((Rectangle){ state->windowBounds.x + 785, state->windowBounds.y + 292 + 24, 16, 16 }, "Define Rectangles", &state->defineRecsChecked);
         GuiCheckBox((Rectangle){ state->windowBounds.x + 785, state->windowBounds.y + 292 + 48, 16, 16 }, "Define text as const", &state->defineTextsChecked);
         GuiCheckBox((Rectangle){ state->windowBounds.x + 785, state->windowBounds.y + 292 + 72, 16, 16 }, "Include detailed comments", &state->fullCommentsChecked);
         GuiCheckBox((Rectangle){ state->windowBounds.x + 785, state->windowBounds.y + 292 + 96, 16, 16 }, "Generate button functions", &state->genButtonFuncsChecked);
+        GuiCheckBox((Rectangle){ state->windowBounds.x + 785, state->windowBounds.y + 292 + 120, 16, 16 }, "Cache static controls", &state->cacheStaticChecked);
 
-        if (state->codeTemplateActive != 2) GuiDisable();
-        state->btnLoadCustomTemplatePressed = GuiButton((Rectangle){ state->windowBounds.x + 775, state->windowBounds.y + 292 + 128, 228, 24 }, state->customTemplateLoaded? "#9#Unload Custom Template" : "#5#Load Custom Template");
+        if (state->codeTemplateActive != 4) GuiDisable();
+        state->btnLoadCustomTemplatePressed = GuiButton((Rectangle){ state->windowBounds.x + 775, state->windowBounds.y + 292 + 152, 228, 24 }, state->customTemplateLoaded? "#9#Unload Custom Template" : "#5#Load Custom Template");
         GuiEnable();
 
         // Export generated code button
-        state->btnExportCodePressed = GuiButton((Rectangle){ state->windowBounds.x + 765, state->windowBounds.y + 278 + 184 + 16, 248, 28 }, "#7#Export Generated Code");
+        state->btnExportCodePressed = GuiButton((Rectangle){ state->windowBounds.x + 765, state->windowBounds.y + 278 + 208 + 16, 248, 28 }, "#7#Export Generated Code");
 
         // Select desired code template to fill
         if (GuiDropdownBox((Rectangle){ state->windowBounds.x + 775, state->windowBounds.y + 256, 228, 24 }, 
-                "STANDARD TEMPLATE (.c);PORTABLE TEMPLATE (.h); CUSTOM TEMPLATE (.c/.h)",
+                "STANDARD TEMPLATE (.c);PORTABLE TEMPLATE (.h);TABLE TEMPLATE (.h);CONSTEXPR C++ TEMPLATE (.hpp); CUSTOM TEMPLATE (.c/.h)",
                 &state->codeTemplateActive, state->codeTemplateEditMode)) state->codeTemplateEditMode = !state->codeTemplateEditMode;
 
         // Draw generated code
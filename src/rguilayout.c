@@ -40,6 +40,10 @@
 *           Use custom raygui generated modal dialogs instead of native OS ones
 *           NOTE: Avoids including tinyfiledialogs depencency library
 *
+*       #define RGUILAYOUT_NO_MAIN
+*           Program main entry point is not defined, tool source can be included by other programs
+*           NOTE: Used by benchmark tool (rguilayout_bench.c) to access layout load/save functions
+*
 *   VERSIONS HISTORY:
 *       4.2  (xx-Nov-2024)  ADDED: New welcome/about window
 *                           ADDED: Configuration file support: config.ini
@@ -159,6 +163,7 @@
 #define GUI_FILE_DIALOGS_IMPLEMENTATION
 #include "gui_file_dialogs.h"               // GUI: File Dialogs
 
+#define RGUILAYOUT_IMPLEMENTATION
 #include "rguilayout.h"                     // Gui layout types definition
 
 #define GUI_PANEL_CONTROLS_PALETTE_IMPLEMENTATION
@@ -197,11 +202,23 @@
 #include "external/rini.h"                  // Config file values reader/writer
 
 // Standard C libraries
-#include <stdlib.h>                         // Required for: calloc(), free()
+#include <stdlib.h>                         // Required for: calloc(), free(), strtof()
 #include <stdarg.h>                         // Required for: va_list, va_start(), vfprintf(), va_end()
 #include <string.h>                         // Required for: strcpy(), strcat(), strlen()
 #include <stdio.h>                          // Required for: FILE, fopen(), fclose()...
 #include <ctype.h>                          // Required for: toupper(), tolower()
+#include <math.h>                           // Required for: floorf()
+
+#if defined(PLATFORM_DESKTOP)
+    #if defined(_WIN32)
+        // NOTE: Windows threads API declared below, windows.h is not included (symbols collision with raylib)
+        #if defined(_MSC_VER)
+            #include <intrin.h>             // Required for: _InterlockedExchangeAdd()
+        #endif
+    #else
+        #include <pthread.h>                // Required for: pthread_create(), pthread_join()
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -210,6 +227,23 @@
 bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib)
 #endif
 
+#if defined(PLATFORM_DESKTOP)
+#if defined(_WIN32)
+void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *startAddress)(void *), void *parameter, unsigned long flags, unsigned long *threadId);  // kernel32.lib
+unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);                // kernel32.lib
+int __stdcall CloseHandle(void *handle);                                                            // kernel32.lib
+#endif
+
+// Atomic fetch and add, used by worker threads: command line jobs, code generation
+#if defined(_MSC_VER)
+    #define ATOMIC_FETCH_ADD(ptr, value) _InterlockedExchangeAdd((volatile long *)(ptr), (value))
+#else
+    #define ATOMIC_FETCH_ADD(ptr, value) __atomic_fetch_add((ptr), (value), __ATOMIC_SEQ_CST)
+#endif
+
+#define MAX_CLI_WORKER_THREADS      64      // Max worker threads for command line code generation (-j)
+#endif
+
 // Simple log system to avoid printf() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
 #define SUPPORT_LOG_INFO
@@ -225,8 +259,17 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
 
 #define MOVEMENT_FRAME_SPEED         2      // Controls movement speed in pixels per frame
 
-#define MAX_UNDO_LEVELS             64      // Undo levels supported for the ring buffer
-#define UNDO_SNAPSHOT_FRAMERATE     90      // Frames to take a new layout snapshot (if changes done), @60 fps = 1.5sec
+#define JOURNAL_STEPS_INITIAL_CAPACITY       64     // Layout journal initial steps capacity (grows on demand)
+#define JOURNAL_OPERATIONS_INITIAL_CAPACITY 256     // Layout journal initial operations capacity (grows on demand)
+#define JOURNAL_MEMORY_STEPS                 64     // Layout journal steps kept in memory (with journal file available)
+#define JOURNAL_FILE_VERSION                101     // Layout journal file version (.rgl.journal)
+#define JOURNAL_FILE_HEADER_SIZE             32     // Layout journal file: header size
+#define JOURNAL_MAX_ANCHORS                4096     // Layout journal max anchor index (journal file data is checked)
+#define JOURNAL_STEP_RECORD_SIZE(count)   (4 + 32 + 8 + (count)*(int)sizeof(JournalOperation) + 4)  // Layout journal file: step record size
+
+#define SPATIAL_INDEX_CELL_SIZE     64      // Layout spatial index grid cell size (pixels)
+#define SPATIAL_INDEX_BUCKETS     1024      // Layout spatial index grid buckets, cells are hashed (power of two)
+#define SPATIAL_INDEX_MAX_CELLS    256      // Layout spatial index max cells per control (larger controls always checked)
 
 #define MAX_ICONS_AVAILABLE        220      // Max raygui icons displayed on icon selector
 
@@ -250,6 +293,155 @@ typedef struct {
     float alpha;
 } Tracemap;
 
+// Layout journal operation type
+typedef enum {
+    JOURNAL_CONTROL_CHANGE = 0,     // Control changed (position, size, anchor, text, name)
+    JOURNAL_CONTROL_CREATE,         // Control created at index
+    JOURNAL_CONTROL_DELETE,         // Control deleted from index
+    JOURNAL_CONTROL_REORDER,        // Controls swapped (layer order)
+    JOURNAL_ANCHOR_CHANGE           // Anchor changed (position, enabled, hidding, name)
+} JournalOperationType;
+
+// Layout journal control state
+// NOTE: Strings are copied, layout strings pool could be compacted
+typedef struct {
+    GuiLayoutControl control;
+    int id;
+    char name[MAX_CONTROL_NAME_LENGTH];
+    char text[MAX_CONTROL_TEXT_LENGTH];
+} JournalControlState;
+
+// Layout journal operation
+// NOTE: States are stored before [0] and after [1] the change, undo applies the inverse operation
+typedef struct {
+    int type;                       // Operation type (JournalOperationType)
+    int index;                      // Control/anchor index
+    int otherIndex;                 // Control swapped index (reorder)
+    bool sealed;                    // Operation state after change stored
+    JournalControlState control[2]; // Control state (control operations)
+    GuiAnchorPoint anchor[2];       // Anchor state (anchor operations)
+} JournalOperation;
+
+// Layout journal step (undo level)
+typedef struct {
+    int firstOperation;             // Step first operation index
+    int operationCount;             // Step operations count
+    Rectangle refWindow[2];         // Reference window, before [0] and after [1] step
+    int anchorCount[2];             // Anchors count, before [0] and after [1] step
+    int offset;                     // Step record offset in journal file
+    int size;                       // Step record size in journal file
+} JournalStep;
+
+// Layout journal, edition operations history for undo/redo
+// NOTE: Changes are recorded on edition and committed as a step once edition finishes,
+// with a journal file available, steps are appended to file and only a window of steps is kept in memory
+typedef struct {
+    JournalStep *steps;             // Steps array in memory (undo + redo steps)
+    int stepCount;                  // Steps count in memory
+    int stepCapacity;               // Steps array allocated capacity
+    int currentStep;                // Steps applied in memory, next undo step is (currentStep - 1)
+
+    int firstStep;                  // History index of first step in memory (previous steps in journal file)
+    int historyCount;               // History steps count (memory and journal file)
+    int savedStep;                  // History step saved to layout file (-1 if not available)
+
+    JournalOperation *operations;   // Operations array, steps operations stored consecutively
+    int operationCount;             // Operations count
+    int operationCapacity;          // Operations array allocated capacity
+
+    JournalStep step;               // Step in recording process
+    int firstPendingOperation;      // First operation not sealed on step in recording
+    int *controlOperation;          // Control change operation (+1) on step in recording, by control index
+    int controlOperationCapacity;   // Control change operations array allocated capacity
+    bool recording;                 // Step recording in process (not committed)
+
+    FILE *file;                     // Journal file, NULL if not available (history kept in memory)
+    char fileName[512 + 16];        // Journal file name (next to layout file)
+    unsigned long long layoutHash;  // Saved layout file data hash, journal is only valid for that file data
+    int windowOffset;               // Journal file offset of first step in memory
+    int dataSize;                   // Journal file valid data size (header and history steps)
+    int fileSize;                   // Journal file size (including discarded redo steps data)
+} LayoutJournal;
+
+// Layout spatial index entry (control)
+typedef struct {
+    Rectangle rec;                  // Control focus rectangle, anchor offset applied
+    int cells[4];                   // Control grid cells range: min x, min y, max x, max y
+    unsigned int generation;        // Control generation when indexed
+    unsigned int anchorGeneration;  // Control anchor generation when indexed
+    bool indexed;                   // Control added to index buckets
+} SpatialIndexEntry;
+
+// Layout spatial index bucket (controls on hashed grid cells)
+typedef struct {
+    int *controls;                  // Controls indices
+    int count;                      // Controls count
+    int capacity;                   // Controls array allocated capacity
+} SpatialIndexBucket;
+
+// Layout spatial index, uniform grid over controls focus rectangles
+// NOTE: Index is synced with layout using layout generations, no work required if layout not changed
+typedef struct {
+    SpatialIndexEntry *entries;     // Controls entries, by control index
+    int entryCount;                 // Controls entries count
+    int entryCapacity;              // Controls entries allocated capacity
+    SpatialIndexBucket buckets[SPATIAL_INDEX_BUCKETS];  // Grid cells buckets
+    SpatialIndexBucket large;       // Controls covering too many cells
+    unsigned int generation;        // Layout generation when synced
+    int textSize;                   // Style text size when synced (groupbox focus rectangle)
+} LayoutSpatialIndex;
+
+// Code generation worker, codegen window code regenerated on a background thread
+// NOTE: Worker only reads its own layout snapshot, config and compiled template (not modified while active),
+// generated code is collected on main thread once worker is finished
+typedef struct {
+    GuiLayout *layout;              // Layout snapshot, copied on worker start
+    GuiLayoutConfig config;         // Code generation config
+    const GuiCodeTemplate *codeTemplate;    // Compiled code template
+    char *codeText;                 // Generated code, available once finished
+    bool active;                    // Worker started, generated code not collected yet
+    long finished;                  // Worker finished generation (atomic access)
+#if defined(PLATFORM_DESKTOP)
+#if defined(_WIN32)
+    void *thread;                   // Worker thread handle
+#else
+    pthread_t thread;               // Worker thread handle
+#endif
+    bool threadActive;              // Worker thread created, requires join
+#endif
+} CodegenWorker;
+
+// Command line job result
+typedef enum {
+    CLI_JOB_SUCCESS = 0,
+    CLI_JOB_ERROR_LOAD,             // Input layout file could not be loaded
+    CLI_JOB_ERROR_WRITE,            // Output file could not be written
+} CliJobResult;
+
+// Command line job, one per input layout file
+typedef struct {
+    char inFileName[512];           // Input layout file name (.rgl)
+    char outFileName[512];          // Output file name (.c, .h, .rgl)
+    char name[64];                  // Layout name for code generation
+    bool layoutOutput;              // Output is a layout file (.rgl format conversion)
+    bool upToDate;                  // Output is up to date, not written
+    int result;                     // Job result (CliJobResult)
+} CliJob;
+
+// Command line jobs batch, shared by all worker threads
+// NOTE: Code template and template variables are loaded before workers start, only read by workers
+typedef struct {
+    CliJob *jobs;                   // Jobs array
+    int count;                      // Jobs count
+    int capacity;                   // Jobs allocated capacity
+    long nextJob;                   // Next job to process (atomic access)
+    const GuiCodeTemplate *codeTemplate;    // Code template for code generation
+    GuiLayoutConfig config;         // Code generation config (name defined per job)
+    bool outputBinary;              // Layout output format (.rgl): text or binary
+    bool useStamps;                 // Use hash stamp files to skip up to date outputs (<output>.stamp)
+    unsigned long long hash;        // Inputs hash common to all jobs: tool version, template, config, variables
+} CliJobBatch;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -263,21 +455,98 @@ static char outFileName[512] = { 0 };       // Output file name (required for fi
 static char customTemplateFileName[512] = { 0 }; // Code generation custom template file name (used to not override working layout filename stored at inFileName)
 
 static bool saveChangesRequired = false;    // Flag to notice save changes are required
+static bool saveBinaryLayout = false;       // Flag to save layout in binary format (keeps last loaded file format)
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(PLATFORM_DESKTOP)
 static void ShowCommandLineInfo(void);                      // Show command line usage info
-static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+static int ProcessCommandLine(int argc, char *argv[]);      // Process command line input, returns 0 on success
+static void AddCliJobInput(CliJobBatch *batch, const char *path, bool responseFile);  // Add command line input: layout file, directory or response file (@file)
+static void ProcessCliJobs(CliJobBatch *batch, int threadCount);    // Process command line jobs, distributed on worker threads
+static void ProcessCliJob(CliJobBatch *batch, CliJob *job);         // Process command line job: load layout, generate code and write output
+static void SaveCliDepFile(const CliJobBatch *batch, const char *fileName, const char *templateFile);   // Save dependencies file (Make/Ninja format)
+static bool IsFileTextEqual(const char *fileName, const char *text);                                    // Check if file text is equal to provided text (no file means not equal)
+static bool IsFileDataEqual(const char *fileName1, const char *fileName2);                              // Check if files data is equal (no file means not equal)
 #endif
+static unsigned long long ComputeDataHash(unsigned long long hash, const void *data, int size);        // Compute data hash (FNV-1a 64-bit), accumulated over previous hash
 
 // Init/Load/Save/Export data functions
-static GuiLayout *LoadLayout(const char *fileName);         // Load raygui layout: empty (NULL) or from file (.rgl)
+static GuiLayout *LoadLayout(const char *fileName);         // Load raygui layout: empty (NULL) or from file (.rgl, text or binary)
 static void UnloadLayout(GuiLayout *layout);                // Unload raygui layout
 static void ResetLayout(GuiLayout *layout);                 // Reset layout to default values
-static void SaveLayout(GuiLayout *layout, const char *fileName);     // Save raygui layout as text file (.rgl)
-
+static void SaveLayout(GuiLayout *layout, const char *fileName, bool binary);  // Save raygui layout as text or binary file (.rgl)
+static void CopyLayout(GuiLayout *dst, const GuiLayout *src);   // Copy layout data
+
+static void ReserveLayoutControls(GuiLayout *layout, int capacity); // Reserve layout controls capacity (grows storage if required)
+static void ReserveLayoutAnchors(GuiLayout *layout, int capacity);  // Reserve layout anchors capacity (grows storage if required)
+static void DeleteLayoutControl(GuiLayout *layout, int index);      // Delete layout control, next controls moved one position
+static void InsertLayoutControl(GuiLayout *layout, int index);      // Insert layout control, next controls moved one position
+static void SwapLayoutControls(GuiLayout *layout, int index1, int index2);  // Swap layout controls position (layer order)
+static void MarkLayoutChanged(GuiLayout *layout);                   // Mark layout as changed, layout generation is increased
+static void MarkLayoutControlChanged(GuiLayout *layout, int index); // Mark layout control as changed
+static void MarkLayoutAnchorChanged(GuiLayout *layout, int index);  // Mark layout anchor as changed
+
+static GuiLayoutString AddLayoutString(GuiLayout *layout, const char *text, int length);   // Add string to layout strings pool (interned)
+static void CompactLayoutStrings(GuiLayout *layout, int capacity, int tableCapacity);       // Compact layout strings pool, unused strings removed
+
+static bool LoadLayoutData(GuiLayout *layout, const unsigned char *data, int size);     // Load layout data from file data (text or binary), returns true if binary
+static void LoadLayoutTextData(GuiLayout *layout, const char *text, int size);          // Load layout data from text file data
+static void LoadLayoutBinaryData(GuiLayout *layout, const unsigned char *data, int size);   // Load layout data from binary file data
+
+// Layout journal functions (undo/redo)
+static void ResetJournal(LayoutJournal *journal);           // Reset layout journal, history cleared
+static void UnloadJournal(LayoutJournal *journal);          // Unload layout journal
+static bool OpenJournal(LayoutJournal *journal, GuiLayout *layout, const char *fileName);    // Open layout journal file, previous session changes recovered (if available)
+static void CloseJournal(LayoutJournal *journal);           // Close layout journal file (removed), history cleared
+static void SaveJournal(LayoutJournal *journal, const GuiLayout *layout, const char *fileName);  // Save layout journal on layout saving (compacted)
+static void RecordLayoutChange(LayoutJournal *journal, GuiLayout *layout);                // Record layout change (reference window, anchors count)
+static void RecordControlChange(LayoutJournal *journal, GuiLayout *layout, int index);    // Record control change, call before changing control
+static void RecordControlCreate(LayoutJournal *journal, GuiLayout *layout, int index);    // Record control creation, call after control creation
+static void RecordControlDelete(LayoutJournal *journal, GuiLayout *layout, int index);    // Record control deletion, call before control deletion
+static void RecordControlReorder(LayoutJournal *journal, GuiLayout *layout, int index, int otherIndex);  // Record controls reorder (swap)
+static void RecordAnchorChange(LayoutJournal *journal, GuiLayout *layout, int index);     // Record anchor change, call before changing anchor
+static bool CommitJournalStep(LayoutJournal *journal, const GuiLayout *layout);     // Commit recorded changes as a new undo step
+static bool UndoJournalStep(LayoutJournal *journal, GuiLayout *layout);             // Undo last step
+static bool RedoJournalStep(LayoutJournal *journal, GuiLayout *layout);             // Redo next step
+static JournalOperation *AddJournalOperation(LayoutJournal *journal, int type, int index);      // Add operation to journal
+static void ReserveJournalStorage(LayoutJournal *journal, int stepCapacity, int operationCapacity);  // Reserve journal steps and operations capacity
+static void WriteJournalHeader(LayoutJournal *journal);                                         // Write journal file header (history state)
+static void WriteJournalStep(LayoutJournal *journal, const JournalStep *step);                  // Write journal step record into journal file
+static bool LoadJournalStep(LayoutJournal *journal, int offset, bool first);                    // Load journal step record from journal file
+static void TrimJournalSteps(LayoutJournal *journal);                                           // Trim memory steps to memory window
+static void SealJournalOperations(LayoutJournal *journal, const GuiLayout *layout);             // Seal pending operations (state after change stored)
+static void GetJournalControlState(const GuiLayout *layout, int index, JournalControlState *state);    // Get control state from layout
+static void SetJournalControlState(GuiLayout *layout, int index, const JournalControlState *state);    // Set control state into layout
+static bool IsJournalOperationValid(JournalOperation *operation);                               // Check journal operation loaded from file (strings terminated)
+static bool IsJournalStepValid(const LayoutJournal *journal, const JournalStep *step, const GuiLayout *layout, bool undo);  // Check journal step can be applied to layout
+static unsigned long long GetLayoutFileHash(const char *fileName);                               // Get layout file data hash (0 if not available)
+
+// Layout spatial index functions (controls focus)
+static void SyncSpatialIndex(LayoutSpatialIndex *index, const GuiLayout *layout);                 // Sync layout spatial index with layout changes
+static void UnloadSpatialIndex(LayoutSpatialIndex *index);                                        // Unload layout spatial index
+static int GetSpatialIndexControl(const LayoutSpatialIndex *index, const GuiLayout *layout, Vector2 point);  // Get topmost control at point
+static int GetSpatialIndexBucket(int cellX, int cellY);                                           // Get spatial index bucket for grid cell
+static void AddSpatialIndexControl(LayoutSpatialIndex *index, int control);                       // Add control to spatial index buckets
+static void RemoveSpatialIndexControl(LayoutSpatialIndex *index, int control);                    // Remove control from spatial index buckets
+static void AddSpatialIndexBucketControl(SpatialIndexBucket *bucket, int control);                // Add control to spatial index bucket
+static void RemoveSpatialIndexBucketControl(SpatialIndexBucket *bucket, int control);             // Remove control from spatial index bucket
+
+// Code generation worker functions (codegen window live code regeneration)
+static void StartCodegenWorker(CodegenWorker *worker, const GuiLayout *layout, const GuiCodeTemplate *codeTemplate, GuiLayoutConfig config);  // Start code generation on layout snapshot, worker must be idle
+static bool IsCodegenWorkerFinished(CodegenWorker *worker);         // Check if code generation worker finished (generated code available)
+static char *WaitCodegenWorker(CodegenWorker *worker);              // Wait for code generation worker, generated code ownership is returned
+static void UnloadCodegenWorker(CodegenWorker *worker);             // Unload code generation worker (running generation is waited)
+
+// Layout text scanning functions, used by LoadLayout()
+static const char *ScanSkipBlanks(const char *ptr, const char *end);                   // Skip blank characters up to line end
+static const char *ScanInt(const char *ptr, const char *end, int *value);               // Scan integer value token
+static const char *ScanFloat(const char *ptr, const char *end, float *value);           // Scan float value token
+static const char *ScanWord(const char *ptr, const char *end, const char **word, int *length);  // Scan word token (no blanks)
+static const char *ScanText(const char *ptr, const char *end, const char **text, int *length);  // Scan remaining line text
+
+#if !defined(RGUILAYOUT_NO_MAIN)
 //----------------------------------------------------------------------------------
 // Program main entry point
 //----------------------------------------------------------------------------------
@@ -302,8 +571,7 @@ int main(int argc, char *argv[])
         }
         else
         {
-            ProcessCommandLine(argc, argv);
-            return 0;
+            return ProcessCommandLine(argc, argv);
         }
     }
 #endif // PLATFORM_DESKTOP
@@ -368,12 +636,12 @@ int main(int argc, char *argv[])
     // Controls variables
     int selectedControl = -1;               // Control selected on layout
     int focusedControl = -1;                // Control focused on layout
+    LayoutSpatialIndex spatialIndex = { 0 }; // Controls spatial index for focus
     int selectedType = GUI_WINDOWBOX;       // Control type selected on panel
 
     // Anchors variables
     int selectedAnchor = -1;
     int focusedAnchor = -1;
-    GuiAnchorPoint auxAnchor = { MAX_ANCHOR_POINTS, 0, 0, 0 };  // Auxiliar anchor, required to move anchors without moving controls
 
     Vector2 panOffset = { 0 };
     Vector2 prevPosition = { 0 };
@@ -441,18 +709,17 @@ int main(int argc, char *argv[])
     // Previous text/name, required when cancel editing
     char prevText[MAX_CONTROL_TEXT_LENGTH] = { 0 };
     char prevName[MAX_CONTROL_NAME_LENGTH] = { 0 };
+
+    // Control text/name edition buffer, layout strings pool is updated on changes
+    char editText[MAX_CONTROL_TEXT_LENGTH] = { 0 };
     //-------------------------------------------------------------------------
 
     // Undo/redo system variables
     //-------------------------------------------------------------------------
-    GuiLayout *undoLayouts = (GuiLayout *)RL_CALLOC(MAX_UNDO_LEVELS, sizeof(GuiLayout));   // Layouts array
-    int currentUndoIndex = 0;
-    int firstUndoIndex = 0;
-    int lastUndoIndex = 0;
-    int undoFrameCounter = 0;
-
-    // Init undo/redo system with current layout
-    for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
+    LayoutJournal journal = { 0 };      // Layout journal, edition changes are recorded as undo steps
+
+    // Open layout journal, changes from a previous session not properly closed are recovered
+    if (inFileName[0] != '\0') OpenJournal(&journal, layout, inFileName);
     //-------------------------------------------------------------------------
 
     // Tracemap (background image for reference) variables
@@ -497,9 +764,14 @@ int main(int argc, char *argv[])
     guiConfig.defineTexts = false;
     guiConfig.fullComments = false;
     guiConfig.exportButtonFunctions = false;
+    guiConfig.cacheStaticControls = false;
 
     GuiLayoutConfig prevGuiConfig = { 0 };
     memcpy(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig));
+    unsigned int codeLayoutGeneration = 0;  // Layout generation of current generated code
+    bool codeRegenRequired = false;         // Code regeneration required (codegen window opened)
+    CodegenWorker codegenWorker = { 0 };    // Code generation worker, codegen window code regenerated on background
+    GuiCodeTemplate codeTemplates[5] = { 0 }; // Compiled code templates cache: standard, header-only, table, constexpr, custom
     //------------------------------------------------------------------------------------
 
     // GUI: Main toolbar panel (file and visualization)
@@ -615,73 +887,27 @@ int main(int argc, char *argv[])
 
         // Undo layout change logic
         //----------------------------------------------------------------------------------
-        // Every second check if current layout has changed and record a new undo state
-        if (!dragMoveMode && !orderLayerMode && !resizeMode && !refWindowEditMode &&
+        // Record a new undo step once edition finishes (if changes done)
+        if (journal.recording && !dragMoveMode && !orderLayerMode && !resizeMode && !refWindowEditMode &&
             !textEditMode && !showIconPanel && !nameEditMode && !anchorEditMode && !anchorLinkMode && !anchorMoveMode)
         {
-            undoFrameCounter++;
-
-            if (undoFrameCounter >= UNDO_SNAPSHOT_FRAMERATE)
-            {
-                if (memcmp(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
-                {
-                    // Move cursor to next available position to record undo
-                    currentUndoIndex++;
-                    if (currentUndoIndex >= MAX_UNDO_LEVELS) currentUndoIndex = 0;
-                    if (currentUndoIndex == firstUndoIndex) firstUndoIndex++;
-                    if (firstUndoIndex >= MAX_UNDO_LEVELS) firstUndoIndex = 0;
-
-                    memcpy(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout));
-
-                    lastUndoIndex = currentUndoIndex;
-
-                    // Set a '*' mark on loaded file name to notice save requirement
-                    if ((inFileName[0] != '\0') && !saveChangesRequired)
-                    {
-                        SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
-                        saveChangesRequired = true;
-                    }
-                }
-
-                undoFrameCounter = 0;
-            }
+            CommitJournalStep(&journal, layout);
         }
-        else undoFrameCounter = 120;
 
-        // Recover previous layout state from buffer
-        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z)) || mainToolbarState.btnUndoPressed)
+        // Set a '*' mark on loaded file name to notice save requirement
+        // NOTE: Layout dirty flag is set on any layout change and cleared on load/save
+        if ((inFileName[0] != '\0') && (layout->dirty != saveChangesRequired))
         {
-            if (currentUndoIndex != firstUndoIndex)
-            {
-                currentUndoIndex--;
-                if (currentUndoIndex < 0) currentUndoIndex = MAX_UNDO_LEVELS - 1;
-
-                if (memcmp(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
-                {
-                    memcpy(layout, &undoLayouts[currentUndoIndex], sizeof(GuiLayout));
-                }
-            }
+            if (layout->dirty) SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
+            else SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+            saveChangesRequired = layout->dirty;
         }
 
-        // Recover next layout state from buffer
-        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y)) || mainToolbarState.btnRedoPressed)
-        {
-            if (currentUndoIndex != lastUndoIndex)
-            {
-                int nextUndoIndex = currentUndoIndex + 1;
-                if (nextUndoIndex >= MAX_UNDO_LEVELS) nextUndoIndex = 0;
-
-                if (nextUndoIndex != firstUndoIndex)
-                {
-                    currentUndoIndex = nextUndoIndex;
+        // Recover previous layout state from journal
+        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z)) || mainToolbarState.btnUndoPressed) UndoJournalStep(&journal, layout);
 
-                    if (memcmp(&undoLayouts[currentUndoIndex], layout, sizeof(GuiLayout)) != 0)
-                    {
-                        memcpy(layout, &undoLayouts[currentUndoIndex], sizeof(GuiLayout));
-                    }
-                }
-            }
-        }
+        // Recover next layout state from journal
+        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y)) || mainToolbarState.btnRedoPressed) RedoJournalStep(&journal, layout);
         //----------------------------------------------------------------------------------
 
         // Dropped files logic
@@ -697,17 +923,14 @@ int main(int argc, char *argv[])
 
                 if (tempLayout != NULL)
                 {
-                    memcpy(layout, tempLayout, sizeof(GuiLayout));
-
-                    // WARNING: When layout is loaded, anchor object references are not set, they must be reset manually
-                    for (int i = 0; i < layout->controlCount; i++) layout->controls[i].ap = &layout->anchors[tempLayout->controls[i].ap->id];
+                    // NOTE: Controls anchor references are relinked to layout anchors on copy
+                    CopyLayout(layout, tempLayout);
 
                     strcpy(inFileName, droppedFiles.paths[0]);
                     SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+                    saveChangesRequired = false;
 
-                    for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
-                    currentUndoIndex = 0;
-                    firstUndoIndex = 0;
+                    OpenJournal(&journal, layout, inFileName);
 
                     UnloadLayout(tempLayout);
                 }
@@ -747,10 +970,8 @@ int main(int argc, char *argv[])
             }
             else
             {
-                GuiLayout outLayout = { 0 };
-                memcpy(&outLayout, layout, sizeof(GuiLayout));
-
-                SaveLayout(&outLayout, inFileName);
+                SaveLayout(layout, inFileName, saveBinaryLayout);
+                SaveJournal(&journal, layout, inFileName);
 
                 SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
                 saveChangesRequired = false;
@@ -760,28 +981,8 @@ int main(int argc, char *argv[])
         // Show dialog: export layout as code
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_E)) || mainToolbarState.btnExportFilePressed)
         {
-            // Setup code generation config parameters
-            strcpy(guiConfig.name, windowCodegenState.toolNameText);
-            strcpy(guiConfig.version, windowCodegenState.toolVersionText);
-            strcpy(guiConfig.company, windowCodegenState.companyText);
-            strcpy(guiConfig.description, windowCodegenState.toolDescriptionText);
-            guiConfig.exportAnchors = windowCodegenState.exportAnchorsChecked;
-            guiConfig.defineRecs = windowCodegenState.defineRecsChecked;
-            guiConfig.defineTexts = windowCodegenState.defineTextsChecked;
-            guiConfig.fullComments = windowCodegenState.fullCommentsChecked;
-            guiConfig.exportButtonFunctions = windowCodegenState.genButtonFuncsChecked;
-
-            // Select desired code template for generation
-            if (windowCodegenState.codeTemplateActive == 0) guiConfig.template = guiTemplateStandardCode;
-            else if (windowCodegenState.codeTemplateActive == 1) guiConfig.template = guiTemplateHeaderOnly;
-            else if (windowCodegenState.codeTemplateActive == 2) guiConfig.template = windowCodegenState.customTemplate;
-
-            // Clear current codeText and generate new layout code
-            RL_FREE(windowCodegenState.codeText);
-            if (guiConfig.template != NULL) windowCodegenState.codeText = GenLayoutCode(guiConfig.template, layout, (Vector2){ 0.0f, 0.0f }, guiConfig);
-
-            // Store current config as prevConfig
-            memcpy(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig));
+            // Request code regeneration, code is generated on codegen window update
+            codeRegenRequired = true;
 
             // Activate code generation export window
             windowCodegenState.codePanelScrollOffset = (Vector2){ 0, 0 };
@@ -801,21 +1002,44 @@ int main(int argc, char *argv[])
             guiConfig.defineTexts = windowCodegenState.defineTextsChecked;
             guiConfig.fullComments = windowCodegenState.fullCommentsChecked;
             guiConfig.exportButtonFunctions = windowCodegenState.genButtonFuncsChecked;
+            guiConfig.cacheStaticControls = windowCodegenState.cacheStaticChecked;
 
             // Select desired code template for generation
             if (windowCodegenState.codeTemplateActive == 0) guiConfig.template = guiTemplateStandardCode;
             else if (windowCodegenState.codeTemplateActive == 1) guiConfig.template = guiTemplateHeaderOnly;
-            else if (windowCodegenState.codeTemplateActive == 2) guiConfig.template = windowCodegenState.customTemplate;
-
-            // Check if config parameter have changed while codegen window is open to regenerate code
-            if (memcmp(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig)) != 0)
+            else if (windowCodegenState.codeTemplateActive == 2) guiConfig.template = guiTemplateTable;
+            else if (windowCodegenState.codeTemplateActive == 3) guiConfig.template = guiTemplateConstexpr;
+            else if (windowCodegenState.codeTemplateActive == 4) guiConfig.template = windowCodegenState.customTemplate;
+
+            // Check if config parameters or layout have changed while codegen window is open to regenerate code
+            // NOTE: Code is generated on a background worker, changes while worker is busy are coalesced
+            // and generated once worker is finished, so only latest changes are generated
+            if (!codegenWorker.active && (codeRegenRequired ||
+                (memcmp(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig)) != 0) || (codeLayoutGeneration != layout->generation)))
             {
-                // Clear current codeText and generate new layout code
-                RL_FREE(windowCodegenState.codeText);
-                windowCodegenState.codeText = GenLayoutCode(guiConfig.template, layout, (Vector2){ 0.0f, 0.0f }, guiConfig);
+                // Compile selected code template, kept cached for following regenerations
+                // NOTE: Compiled templates are only modified while worker is idle
+                GuiCodeTemplate *codeTemplate = &codeTemplates[windowCodegenState.codeTemplateActive];
+                if (codeTemplate->text != guiConfig.template)
+                {
+                    UnloadCodeTemplate(*codeTemplate);
+                    *codeTemplate = LoadCodeTemplate(guiConfig.template);
+                }
+
+                // Generate layout code on worker, layout snapshot is taken
+                StartCodegenWorker(&codegenWorker, layout, codeTemplate, guiConfig);
 
                 // Store current config as prevConfig
                 memcpy(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig));
+                codeLayoutGeneration = layout->generation;
+                codeRegenRequired = false;
+            }
+
+            // Swap current codeText with generated code once worker is finished
+            if (IsCodegenWorkerFinished(&codegenWorker))
+            {
+                RL_FREE(windowCodegenState.codeText);
+                windowCodegenState.codeText = WaitCodegenWorker(&codegenWorker);
             }
         }
 
@@ -838,10 +1062,10 @@ int main(int argc, char *argv[])
             {
                 textEditMode = false;
                 showIconPanel = false;
-                if (selectedControl != -1)
+                if ((selectedControl != -1) && !TextIsEqual(prevText, GetLayoutString(layout, layout->controlsInfo[selectedControl].text)))
                 {
-                    memset(layout->controls[selectedControl].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                    strcpy(layout->controls[selectedControl].text, prevText);
+                    RecordControlChange(&journal, layout, selectedControl);
+                    layout->controlsInfo[selectedControl].text = AddLayoutString(layout, prevText, (int)strlen(prevText));
                 }
             }
             else if (nameEditMode)  // Cancel name edit mode
@@ -849,12 +1073,16 @@ int main(int argc, char *argv[])
                 nameEditMode = false;
                 if (selectedControl != -1)
                 {
-                    memset(layout->controls[selectedControl].name, 0, MAX_CONTROL_NAME_LENGTH);
-                    strcpy(layout->controls[selectedControl].name, prevName);
+                    if (!TextIsEqual(prevName, GetLayoutString(layout, layout->controlsInfo[selectedControl].name)))
+                    {
+                        RecordControlChange(&journal, layout, selectedControl);
+                        layout->controlsInfo[selectedControl].name = AddLayoutString(layout, prevName, (int)strlen(prevName));
+                    }
                 }
-                else if (selectedAnchor != -1)
+                else if ((selectedAnchor != -1) && !TextIsEqual(prevName, layout->anchors[selectedAnchor].name))
                 {
-                    memset(layout->anchors[selectedAnchor].name, 0, MAX_CONTROL_NAME_LENGTH);
+                    RecordAnchorChange(&journal, layout, selectedAnchor);
+                    memset(layout->anchors[selectedAnchor].name, 0, MAX_ANCHOR_NAME_LENGTH);
                     strcpy(layout->anchors[selectedAnchor].name, prevName);
                 }
             }
@@ -1095,33 +1323,11 @@ int main(int argc, char *argv[])
                     focusedControl = -1;
 
                     // Focus control logic
+                    // NOTE: Spatial index is only updated for changed controls
                     if (!anchorEditMode && (focusedAnchor == -1))
                     {
-                        for (int i = layout->controlCount - 1; i >= 0; i--)
-                        {
-                            if (!layout->controls[i].ap->hidding)
-                            {
-                                Rectangle layoutRec = layout->controls[i].rec;
-                                if (layout->controls[i].type == GUI_WINDOWBOX) layoutRec.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT;  // Defined inside raygui.h
-                                else if (layout->controls[i].type == GUI_GROUPBOX)
-                                {
-                                    layoutRec.y -= 10;
-                                    layoutRec.height = GuiGetStyle(DEFAULT, TEXT_SIZE)*2.0f;
-                                }
-
-                                if (layout->controls[i].ap->id > 0)
-                                {
-                                    layoutRec.x += layout->controls[i].ap->x;
-                                    layoutRec.y += layout->controls[i].ap->y;
-                                }
-
-                                if (CheckCollisionPointRec(mouse, layoutRec))
-                                {
-                                    focusedControl = i;
-                                    break;
-                                }
-                            }
-                        }
+                        SyncSpatialIndex(&spatialIndex, layout);
+                        focusedControl = GetSpatialIndexControl(&spatialIndex, layout, mouse);
                     }
                 }
 
@@ -1140,8 +1346,10 @@ int main(int argc, char *argv[])
                         {
                             if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
                             {
+                                ReserveLayoutControls(layout, layout->controlCount + 1);
+
                                 // Control basic configuration
-                                layout->controls[layout->controlCount].id = layout->controlCount;
+                                layout->controlsInfo[layout->controlCount].id = layout->controlCount;
                                 layout->controls[layout->controlCount].type = selectedType;
                                 layout->controls[layout->controlCount].rec = defaultRec[selectedType];  // Use default rectangle for control creation
 
@@ -1167,7 +1375,7 @@ int main(int argc, char *argv[])
                                     || (layout->controls[layout->controlCount].type == GUI_STATUSBAR)
                                     || (layout->controls[layout->controlCount].type == GUI_DUMMYREC))
                                 {
-                                    strcpy(layout->controls[layout->controlCount].text, "SAMPLE TEXT");
+                                    layout->controlsInfo[layout->controlCount].text = AddLayoutString(layout, "SAMPLE TEXT", 11);
                                 }
 
                                 // Control text definition: control options
@@ -1176,15 +1384,15 @@ int main(int argc, char *argv[])
                                     || (layout->controls[layout->controlCount].type == GUI_DROPDOWNBOX)
                                     || (layout->controls[layout->controlCount].type == GUI_LISTVIEW))
                                 {
-                                    strcpy(layout->controls[layout->controlCount].text, "ONE;TWO;THREE");
+                                    layout->controlsInfo[layout->controlCount].text = AddLayoutString(layout, "ONE;TWO;THREE", 13);
                                 }
 
                                 // Control name definition (type + count)
-                                strcpy(layout->controls[layout->controlCount].name,
-                                       TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount));
+                                const char *controlName = TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount);
+                                layout->controlsInfo[layout->controlCount].name = AddLayoutString(layout, controlName, (int)strlen(controlName));
 
                                 // Control anchor point definition: Default to anchor[0] = (0, 0)
-                                layout->controls[layout->controlCount].ap = &layout->anchors[0];
+                                layout->controls[layout->controlCount].anchorId = 0;
 
                                 // Control anchor point redefinition if created inside a GuiWindowBox(),
                                 // anchor the new control to the GuiWindowBox() anchor
@@ -1192,25 +1400,28 @@ int main(int argc, char *argv[])
                                 {
                                     if ((layout->controls[i].type == GUI_WINDOWBOX) || (layout->controls[i].type == GUI_GROUPBOX))
                                     {
-                                        if (CheckCollisionPointRec(mouse, (Rectangle){ layout->controls[i].ap->x + layout->controls[i].rec.x,
-                                                                                       layout->controls[i].ap->y + layout->controls[i].rec.y,
+                                        if (CheckCollisionPointRec(mouse, (Rectangle){ layout->anchors[layout->controls[i].anchorId].x + layout->controls[i].rec.x,
+                                                                                       layout->anchors[layout->controls[i].anchorId].y + layout->controls[i].rec.y,
                                                                                        layout->controls[i].rec.width, layout->controls[i].rec.height }))
                                         {
-                                            layout->controls[layout->controlCount].ap = layout->controls[i].ap;
+                                            layout->controls[layout->controlCount].anchorId = layout->controls[i].anchorId;
                                             break;
                                         }
                                     }
                                 }
 
                                 // Create anchor for GuiWindowBox() or GuiGroupBox() controls
-                                if ((layout->anchorCount < MAX_ANCHOR_POINTS) &&
-                                    ((layout->controls[layout->controlCount].type == GUI_WINDOWBOX) ||
-                                     (layout->controls[layout->controlCount].type == GUI_GROUPBOX)))
+                                if ((layout->controls[layout->controlCount].type == GUI_WINDOWBOX) ||
+                                    (layout->controls[layout->controlCount].type == GUI_GROUPBOX))
                                 {
-                                    for (int i = 1; i < MAX_ANCHOR_POINTS; i++)
+                                    ReserveLayoutAnchors(layout, layout->anchorCount + 1);
+
+                                    for (int i = 1; i < layout->anchorCapacity; i++)
                                     {
                                         if (!layout->anchors[i].enabled)
                                         {
+                                            RecordAnchorChange(&journal, layout, i);
+
                                             layout->anchors[i].x = layout->controls[layout->controlCount].rec.x;
                                             layout->anchors[i].y = layout->controls[layout->controlCount].rec.y;
 
@@ -1230,7 +1441,7 @@ int main(int argc, char *argv[])
                                             layout->controls[layout->controlCount].rec.y = layout->anchors[i].y;
 
                                             layout->anchors[i].enabled = true;
-                                            layout->controls[layout->controlCount].ap = &layout->anchors[i];
+                                            layout->controls[layout->controlCount].anchorId = i;
 
                                             layout->anchorCount++;
                                             break;
@@ -1238,13 +1449,14 @@ int main(int argc, char *argv[])
                                     }
                                 }
 
-                                if (layout->controls[layout->controlCount].ap->id > 0)
+                                if (layout->controls[layout->controlCount].anchorId > 0)
                                 {
-                                    layout->controls[layout->controlCount].rec.x -= layout->controls[layout->controlCount].ap->x;
-                                    layout->controls[layout->controlCount].rec.y -= layout->controls[layout->controlCount].ap->y;
+                                    layout->controls[layout->controlCount].rec.x -= layout->anchors[layout->controls[layout->controlCount].anchorId].x;
+                                    layout->controls[layout->controlCount].rec.y -= layout->anchors[layout->controls[layout->controlCount].anchorId].y;
                                 }
 
                                 layout->controlCount++;
+                                RecordControlCreate(&journal, layout, layout->controlCount - 1);
 
                                 focusedControl = layout->controlCount - 1;
                                 selectedControl = layout->controlCount - 1;
@@ -1265,21 +1477,15 @@ int main(int argc, char *argv[])
                         if ((newOrder > 0) && (focusedControl < layout->controlCount - 1))
                         {
                             // Move control towards beginning of array
-                            GuiLayoutControl auxControl = layout->controls[focusedControl];
-                            layout->controls[focusedControl] = layout->controls[focusedControl + 1];
-                            layout->controls[focusedControl].id -= 1;
-                            layout->controls[focusedControl + 1] = auxControl;
-                            layout->controls[focusedControl + 1].id += 1;
+                            RecordControlReorder(&journal, layout, focusedControl, focusedControl + 1);
+                            SwapLayoutControls(layout, focusedControl, focusedControl + 1);
                             selectedControl = -1;
                         }
                         else if ((newOrder < 0) && (focusedControl > 0))
                         {
                             // Move control towards end of array
-                            GuiLayoutControl auxControl = layout->controls[focusedControl];
-                            layout->controls[focusedControl] = layout->controls[focusedControl - 1];
-                            layout->controls[focusedControl].id += 1;
-                            layout->controls[focusedControl - 1] = auxControl;
-                            layout->controls[focusedControl - 1].id -= 1;
+                            RecordControlReorder(&journal, layout, focusedControl, focusedControl - 1);
+                            SwapLayoutControls(layout, focusedControl, focusedControl - 1);
                             selectedControl = -1;
                         }
                     }
@@ -1301,10 +1507,10 @@ int main(int argc, char *argv[])
                     Rectangle rec = layout->controls[selectedControl].rec;
 
                     // NOTE: Anchor offset must be considered
-                    if (layout->controls[selectedControl].ap->id > 0)
+                    if (layout->controls[selectedControl].anchorId > 0)
                     {
-                        rec.x += layout->controls[selectedControl].ap->x;
-                        rec.y += layout->controls[selectedControl].ap->y;
+                        rec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                        rec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
                     }
 
                     if (CheckCollisionPointRec(GetMousePosition(), rec) &&
@@ -1330,13 +1536,18 @@ int main(int argc, char *argv[])
                             (rec.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2)) rec.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2;
 
                         // NOTE: Anchor offset must be considered
-                        if (layout->controls[selectedControl].ap->id > 0)
+                        if (layout->controls[selectedControl].anchorId > 0)
                         {
-                            rec.x -= layout->controls[selectedControl].ap->x;
-                            rec.y -= layout->controls[selectedControl].ap->y;
+                            rec.x -= layout->anchors[layout->controls[selectedControl].anchorId].x;
+                            rec.y -= layout->anchors[layout->controls[selectedControl].anchorId].y;
                         }
 
-                        layout->controls[selectedControl].rec = rec;
+                        if ((rec.x != layout->controls[selectedControl].rec.x) || (rec.y != layout->controls[selectedControl].rec.y) ||
+                            (rec.width != layout->controls[selectedControl].rec.width) || (rec.height != layout->controls[selectedControl].rec.height))
+                        {
+                            RecordControlChange(&journal, layout, selectedControl);
+                            layout->controls[selectedControl].rec = rec;
+                        }
 
                         if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) mouseScaleMode = false;
                     }
@@ -1362,14 +1573,18 @@ int main(int argc, char *argv[])
                                 else controlPosY -= offsetY;
                             }
 
-                            if (showGlobalPosition && (layout->controls[selectedControl].ap->id != 0))
+                            if (showGlobalPosition && (layout->controls[selectedControl].anchorId != 0))
                             {
-                                controlPosX -= layout->controls[selectedControl].ap->x;
-                                controlPosY -= layout->controls[selectedControl].ap->y;
+                                controlPosX -= layout->anchors[layout->controls[selectedControl].anchorId].x;
+                                controlPosY -= layout->anchors[layout->controls[selectedControl].anchorId].y;
                             }
 
-                            layout->controls[selectedControl].rec.x = controlPosX;
-                            layout->controls[selectedControl].rec.y = controlPosY;
+                            if ((controlPosX != (int)layout->controls[selectedControl].rec.x) || (controlPosY != (int)layout->controls[selectedControl].rec.y))
+                            {
+                                RecordControlChange(&journal, layout, selectedControl);
+                                layout->controls[selectedControl].rec.x = controlPosX;
+                                layout->controls[selectedControl].rec.y = controlPosY;
+                            }
 
                             if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) dragMoveMode = false;
                         }
@@ -1380,21 +1595,27 @@ int main(int argc, char *argv[])
                                 // Duplicate control
                                 if (IsKeyPressed(KEY_D))
                                 {
-                                    layout->controls[layout->controlCount].id = layout->controlCount;
+                                    ReserveLayoutControls(layout, layout->controlCount + 1);
+
+                                    layout->controlsInfo[layout->controlCount].id = layout->controlCount;
                                     layout->controls[layout->controlCount].type = layout->controls[selectedControl].type;
                                     layout->controls[layout->controlCount].rec = layout->controls[selectedControl].rec;
                                     layout->controls[layout->controlCount].rec.x += 10;
                                     layout->controls[layout->controlCount].rec.y += 10;
-                                    strcpy(layout->controls[layout->controlCount].text, layout->controls[selectedControl].text);
-                                    strcpy(layout->controls[layout->controlCount].name, TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount));
-                                    layout->controls[layout->controlCount].ap = layout->controls[selectedControl].ap;            // Default anchor point (0, 0)
+                                    layout->controlsInfo[layout->controlCount].text = layout->controlsInfo[selectedControl].text;     // NOTE: Strings are interned, reference is shared
+                                    const char *controlName = TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount);
+                                    layout->controlsInfo[layout->controlCount].name = AddLayoutString(layout, controlName, (int)strlen(controlName));
+                                    layout->controls[layout->controlCount].anchorId = layout->controls[selectedControl].anchorId;            // Default anchor point (0, 0)
 
                                     layout->controlCount++;
+                                    RecordControlCreate(&journal, layout, layout->controlCount - 1);
 
                                     selectedControl = layout->controlCount - 1;
                                 }
 
                                 // Resize control
+                                if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_UP)) RecordControlChange(&journal, layout, selectedControl);
+
                                 int offsetX = (int)layout->controls[selectedControl].rec.width%gridSnapDelta;
                                 int offsetY = (int)layout->controls[selectedControl].rec.height%gridSnapDelta;
 
@@ -1450,10 +1671,10 @@ int main(int argc, char *argv[])
                                 int controlPosX = (int)layout->controls[selectedControl].rec.x;
                                 int controlPosY = (int)layout->controls[selectedControl].rec.y;
 
-                                if (showGlobalPosition && (layout->controls[selectedControl].ap->id != 0))
+                                if (showGlobalPosition && (layout->controls[selectedControl].anchorId != 0))
                                 {
-                                    controlPosX += layout->controls[selectedControl].ap->x;
-                                    controlPosY += layout->controls[selectedControl].ap->y;
+                                    controlPosX += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                                    controlPosY += layout->anchors[layout->controls[selectedControl].anchorId].y;
                                 }
 
                                 int offsetX = (int)controlPosX%gridSnapDelta;
@@ -1501,23 +1722,27 @@ int main(int argc, char *argv[])
                                     }
                                 }
 
-                                if (showGlobalPosition && (layout->controls[selectedControl].ap->id != 0))
+                                if (showGlobalPosition && (layout->controls[selectedControl].anchorId != 0))
                                 {
-                                    controlPosX -= layout->controls[selectedControl].ap->x;
-                                    controlPosY -= layout->controls[selectedControl].ap->y;
+                                    controlPosX -= layout->anchors[layout->controls[selectedControl].anchorId].x;
+                                    controlPosY -= layout->anchors[layout->controls[selectedControl].anchorId].y;
                                 }
 
-                                layout->controls[selectedControl].rec.x = controlPosX;
-                                layout->controls[selectedControl].rec.y = controlPosY;
+                                if ((controlPosX != (int)layout->controls[selectedControl].rec.x) || (controlPosY != (int)layout->controls[selectedControl].rec.y))
+                                {
+                                    RecordControlChange(&journal, layout, selectedControl);
+                                    layout->controls[selectedControl].rec.x = controlPosX;
+                                    layout->controls[selectedControl].rec.y = controlPosY;
+                                }
                                 //---------------------------------------------------------------------
 
                                 // Unlinks the control selected from its current anchor
-                                if ((layout->controls[selectedControl].ap->id != 0) && IsKeyPressed(KEY_U))
+                                if ((layout->controls[selectedControl].anchorId != 0) && IsKeyPressed(KEY_U))
                                 {
-
-                                    layout->controls[selectedControl].rec.x += layout->controls[selectedControl].ap->x;
-                                    layout->controls[selectedControl].rec.y += layout->controls[selectedControl].ap->y;
-                                    layout->controls[selectedControl].ap = &layout->anchors[0];
+                                    RecordControlChange(&journal, layout, selectedControl);
+                                    layout->controls[selectedControl].rec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                                    layout->controls[selectedControl].rec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
+                                    layout->controls[selectedControl].anchorId = 0;
                                 }
 
                                 // Delete selected control
@@ -1525,18 +1750,8 @@ int main(int argc, char *argv[])
                                 {
                                     mouseScaleReady = false;
 
-                                    for (int i = selectedControl; i < layout->controlCount; i++)
-                                    {
-                                        layout->controls[i].type = layout->controls[i + 1].type;
-                                        layout->controls[i].rec = layout->controls[i + 1].rec;
-                                        memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                                        memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-                                        strcpy(layout->controls[i].text, layout->controls[i + 1].text);
-                                        strcpy(layout->controls[i].name, layout->controls[i + 1].name);
-                                        layout->controls[i].ap = layout->controls[i + 1].ap;
-                                    }
-
-                                    layout->controlCount--;
+                                    RecordControlDelete(&journal, layout, selectedControl);
+                                    DeleteLayoutControl(layout, selectedControl);
                                     focusedControl = -1;
                                     selectedControl = -1;
                                 }
@@ -1546,10 +1761,10 @@ int main(int argc, char *argv[])
                                 {
                                     panOffset = mouse;
 
-                                    if (showGlobalPosition && (layout->controls[selectedControl].ap->id != 0))
+                                    if (showGlobalPosition && (layout->controls[selectedControl].anchorId != 0))
                                     {
-                                        prevPosition = (Vector2){ layout->controls[selectedControl].rec.x + layout->controls[selectedControl].ap->x,
-                                                                  layout->controls[selectedControl].rec.y + layout->controls[selectedControl].ap->y };
+                                        prevPosition = (Vector2){ layout->controls[selectedControl].rec.x + layout->anchors[layout->controls[selectedControl].anchorId].x,
+                                                                  layout->controls[selectedControl].rec.y + layout->anchors[layout->controls[selectedControl].anchorId].y };
                                     }
                                     else prevPosition = (Vector2){ layout->controls[selectedControl].rec.x, layout->controls[selectedControl].rec.y };
 
@@ -1561,14 +1776,16 @@ int main(int argc, char *argv[])
                                 }
                                 else if (IsKeyReleased(KEY_T))      // Enable text edit mode
                                 {
-                                    strcpy(prevText, layout->controls[selectedControl].text);
-                                    textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].text);
+                                    strcpy(prevText, GetLayoutString(layout, layout->controlsInfo[selectedControl].text));
+                                    strcpy(editText, prevText);
+                                    textBoxCursorIndex = (int)strlen(editText);
                                     textEditMode = true;
                                 }
                                 else if (IsKeyReleased(KEY_N))      // Enable name edit mode
                                 {
-                                    strcpy(prevName, layout->controls[selectedControl].name);
-                                    textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].name);
+                                    strcpy(prevName, GetLayoutString(layout, layout->controlsInfo[selectedControl].name));
+                                    strcpy(editText, prevName);
+                                    textBoxCursorIndex = (int)strlen(editText);
                                     nameEditMode = true;
                                 }
                             }
@@ -1580,12 +1797,13 @@ int main(int argc, char *argv[])
                         {
                             anchorLinkMode = false;
 
-                            if (layout->controls[selectedControl].ap->id > 0)
+                            RecordControlChange(&journal, layout, selectedControl);
+                            if (layout->controls[selectedControl].anchorId > 0)
                             {
-                                layout->controls[selectedControl].rec.x += layout->controls[selectedControl].ap->x;
-                                layout->controls[selectedControl].rec.y += layout->controls[selectedControl].ap->y;
+                                layout->controls[selectedControl].rec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                                layout->controls[selectedControl].rec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
                             }
-                            layout->controls[selectedControl].ap = &layout->anchors[focusedAnchor];
+                            layout->controls[selectedControl].anchorId = focusedAnchor;
                             if (focusedAnchor > 0)
                             {
                                 layout->controls[selectedControl].rec.x -= layout->anchors[focusedAnchor].x;
@@ -1677,18 +1895,7 @@ int main(int argc, char *argv[])
             {
                 for (int j = 0; j < multiSelectCount; j++)
                 {
-                    for (int i = multiSelectControls[j]; i < layout->controlCount; i++)
-                    {
-                        layout->controls[i].type = layout->controls[i + 1].type;
-                        layout->controls[i].rec = layout->controls[i + 1].rec;
-                        memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                        memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-                        strcpy(layout->controls[i].text, layout->controls[i + 1].text);
-                        strcpy(layout->controls[i].name, layout->controls[i + 1].name);
-                        layout->controls[i].ap = layout->controls[i + 1].ap;
-                    }
-
-                    layout->controlCount--;
+                    DeleteLayoutControl(layout, multiSelectControls[j]);
 
                     // As all controls are moved one position, need to update selected
                     // controls position for next control deletion
@@ -1713,7 +1920,7 @@ int main(int argc, char *argv[])
                 focusedAnchor = -1;
 
                 // NOTE: Allowing selection of reference anchor[0]
-                for (int i = 0; i < MAX_ANCHOR_POINTS; i++)
+                for (int i = 0; i < layout->anchorCapacity; i++)
                 {
                     if (layout->anchors[i].enabled)
                     {
@@ -1733,17 +1940,20 @@ int main(int argc, char *argv[])
                 if (anchorEditMode &&
                     !anchorLinkMode &&
                     !tracemap.focused &&
-                    !tracemap.selected &&
-                    (layout->anchorCount < MAX_ANCHOR_POINTS))
+                    !tracemap.selected)
                 {
                     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
                     {
+                        ReserveLayoutAnchors(layout, layout->anchorCount + 1);
+
                         // NOTE: layout.anchor[0] is reference point
+                        RecordLayoutChange(&journal, layout);
                         layout->anchorCount++;
-                        for (int i = 1; i < MAX_ANCHOR_POINTS; i++)
+                        for (int i = 1; i < layout->anchorCapacity; i++)
                         {
                             if (!layout->anchors[i].enabled)
                             {
+                                RecordAnchorChange(&journal, layout, i);
                                 layout->anchors[i].x = mouse.x;
                                 layout->anchors[i].y = mouse.y;
                                 layout->anchors[i].enabled = true;
@@ -1773,15 +1983,20 @@ int main(int argc, char *argv[])
                     if (refWindowEditMode)
                     {
                         // NOTE: In the case of ref-window, just define size
-                        layout->refWindow.width = mouse.x - layout->refWindow.x;
-                        layout->refWindow.height = mouse.y  - layout->refWindow.y;
+                        Rectangle refWindow = { layout->refWindow.x, layout->refWindow.y, mouse.x - layout->refWindow.x, mouse.y - layout->refWindow.y };
 
                         if (IsMouseButtonReleased(MOUSE_RIGHT_BUTTON))
                         {
-                            if (layout->refWindow.width < 0) layout->refWindow.width = -1;
-                            if (layout->refWindow.height < 0) layout->refWindow.height = -1;
+                            if (refWindow.width < 0) refWindow.width = -1;
+                            if (refWindow.height < 0) refWindow.height = -1;
                             refWindowEditMode = false;
                         }
+
+                        if ((refWindow.width != layout->refWindow.width) || (refWindow.height != layout->refWindow.height))
+                        {
+                            RecordLayoutChange(&journal, layout);
+                            layout->refWindow = refWindow;
+                        }
                     }
                     else    // Not refWindowEditMode
                     {
@@ -1789,71 +2004,37 @@ int main(int argc, char *argv[])
                         {
                             //if (selectedAnchor == 0) anchorEditMode = false;
 
-                            // Move anchor without moving controls
-                            if (anchorMoveMode && !anchorEditMode)
+                            // Move anchor without moving controls, linked controls position is compensated
+                            anchorMoveMode = anchorEditMode;
+
+                            if (((int)mouse.x != layout->anchors[selectedAnchor].x) || ((int)mouse.y != layout->anchors[selectedAnchor].y))
                             {
-                                for (int i = 0; i < layout->controlCount; i++)
+                                if (anchorMoveMode)
                                 {
-                                    if (layout->controls[i].ap->id == MAX_ANCHOR_POINTS)    // Auxiliar anchor id
+                                    for (int i = 0; i < layout->controlCount; i++)
                                     {
-                                        if (layout->controls[i].ap->id > 0)
+                                        if (layout->controls[i].anchorId == selectedAnchor)
                                         {
-                                            layout->controls[i].rec.x += layout->controls[i].ap->x;
-                                            layout->controls[i].rec.y += layout->controls[i].ap->y;
+                                            RecordControlChange(&journal, layout, i);
+                                            layout->controls[i].rec.x -= ((int)mouse.x - layout->anchors[selectedAnchor].x);
+                                            layout->controls[i].rec.y -= ((int)mouse.y - layout->anchors[selectedAnchor].y);
                                         }
-                                        layout->controls[i].ap = &layout->anchors[selectedAnchor];
-                                        layout->controls[i].rec.x -= layout->anchors[selectedAnchor].x;
-                                        layout->controls[i].rec.y -= layout->anchors[selectedAnchor].y;
                                     }
                                 }
-                                anchorMoveMode = false;
-                            }
 
-                            // Move anchor without moving controls
-                            if (!anchorMoveMode && anchorEditMode)
-                            {
-                                anchorMoveMode = true;
+                                RecordAnchorChange(&journal, layout, selectedAnchor);
+                                layout->anchors[selectedAnchor].x = mouse.x;
+                                layout->anchors[selectedAnchor].y = mouse.y;
 
-                                for (int i = 0; i < layout->controlCount; i++)
-                                {
-                                    if (layout->controls[i].ap->id == selectedAnchor)
-                                    {
-                                        layout->controls[i].rec.x += layout->controls[i].ap->x;
-                                        layout->controls[i].rec.y += layout->controls[i].ap->y;
-                                        layout->controls[i].ap = &auxAnchor;
-                                    }
-                                }
+                                if (selectedAnchor == 0) layout->refWindow = (Rectangle){ layout->anchors[0].x, layout->anchors[0].y, layout->refWindow.width, layout->refWindow.height };
                             }
 
-                            layout->anchors[selectedAnchor].x = mouse.x;
-                            layout->anchors[selectedAnchor].y = mouse.y;
-
-                            if (selectedAnchor == 0)
-                            {
-                                anchorEditMode = false;
-                                layout->refWindow = (Rectangle){layout->anchors[0].x, layout->anchors[0].y, layout->refWindow.width, layout->refWindow.height};
-                            }
+                            if (selectedAnchor == 0) anchorEditMode = false;
 
                             // Exit anchor position edit mode
                             if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
                             {
-                                // If moving only the anchor, relink with controls
-                                if (anchorMoveMode)
-                                {
-                                    for (int i = 0; i < layout->controlCount; i++)
-                                    {
-                                        if (layout->controls[i].ap->id == MAX_ANCHOR_POINTS)  // Auxiliar anchor id
-                                        {
-                                            layout->controls[i].rec.x += layout->controls[i].ap->x;
-                                            layout->controls[i].rec.y += layout->controls[i].ap->y;
-                                            layout->controls[i].ap = &layout->anchors[selectedAnchor];
-                                            layout->controls[i].rec.x -= layout->anchors[selectedAnchor].x;
-                                            layout->controls[i].rec.y -= layout->anchors[selectedAnchor].y;
-                                        }
-                                    }
-                                    anchorMoveMode = false;
-                                }
-
+                                anchorMoveMode = false;
                                 dragMoveMode = false;
                             }
                         }
@@ -1863,20 +2044,21 @@ int main(int argc, char *argv[])
                             {
                                 if (IsKeyPressed(KEY_D)) // Duplicate anchor
                                 {
-                                    if (layout->anchorCount < MAX_ANCHOR_POINTS)
+                                    ReserveLayoutAnchors(layout, layout->anchorCount + 1);
+
+                                    RecordLayoutChange(&journal, layout);
+                                    layout->anchorCount++;
+                                    for (int i = 1; i < layout->anchorCapacity; i++)
                                     {
-                                        layout->anchorCount++;
-                                        for (int i = 1; i < MAX_ANCHOR_POINTS; i++)
+                                        if (!layout->anchors[i].enabled && i != selectedAnchor)
                                         {
-                                            if (!layout->anchors[i].enabled && i != selectedAnchor)
-                                            {
-                                                layout->anchors[i].x = layout->anchors[selectedAnchor].x + 10;
-                                                layout->anchors[i].y = layout->anchors[selectedAnchor].y + 10;
-                                                layout->anchors[i].enabled = true;
-                                                focusedAnchor = i;
-                                                selectedAnchor = i;
-                                                break;
-                                            }
+                                            RecordAnchorChange(&journal, layout, i);
+                                            layout->anchors[i].x = layout->anchors[selectedAnchor].x + 10;
+                                            layout->anchors[i].y = layout->anchors[selectedAnchor].y + 10;
+                                            layout->anchors[i].enabled = true;
+                                            focusedAnchor = i;
+                                            selectedAnchor = i;
+                                            break;
                                         }
                                     }
                                 }
@@ -1886,6 +2068,8 @@ int main(int argc, char *argv[])
                                 int offsetX = (int)layout->anchors[selectedAnchor].x%gridSnapDelta;
                                 int offsetY = (int)layout->anchors[selectedAnchor].y%gridSnapDelta;
 
+                                if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_UP)) RecordAnchorChange(&journal, layout, selectedAnchor);
+
                                 // Move anchor with arrows once
                                 if (precisionEditMode)
                                 {
@@ -1929,7 +2113,11 @@ int main(int argc, char *argv[])
                                     }
                                 }
 
-                                if (selectedAnchor == 0) layout->refWindow = (Rectangle){ layout->anchors[0].x, layout->anchors[0].y, layout->refWindow.width, layout->refWindow.height };
+                                if ((selectedAnchor == 0) && ((layout->refWindow.x != layout->anchors[0].x) || (layout->refWindow.y != layout->anchors[0].y)))
+                                {
+                                    RecordLayoutChange(&journal, layout);
+                                    layout->refWindow = (Rectangle){ layout->anchors[0].x, layout->anchors[0].y, layout->refWindow.width, layout->refWindow.height };
+                                }
 
                                 // Activate anchor position edit mode
                                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) dragMoveMode = true;
@@ -1938,21 +2126,28 @@ int main(int argc, char *argv[])
                                     if (selectedAnchor == 0) refWindowEditMode = true;  // Activate ref window edit
                                     else anchorLinkMode = true;  // Activate anchor link mode
                                 }
-                                else if (IsKeyPressed(KEY_H)) layout->anchors[selectedAnchor].hidding = !layout->anchors[selectedAnchor].hidding;   // Hide/Unhide anchors
+                                else if (IsKeyPressed(KEY_H))           // Hide/Unhide anchors
+                                {
+                                    RecordAnchorChange(&journal, layout, selectedAnchor);
+                                    layout->anchors[selectedAnchor].hidding = !layout->anchors[selectedAnchor].hidding;
+                                }
                                 else if (IsKeyPressed(KEY_U) && (selectedAnchor > 0))                   // Unlinks controls from selected anchor
                                 {
                                     for (int i = 0; i < layout->controlCount; i++)
                                     {
-                                        if (layout->controls[i].ap->id == selectedAnchor)
+                                        if (layout->controls[i].anchorId == selectedAnchor)
                                         {
-                                            layout->controls[i].rec.x += layout->controls[i].ap->x;
-                                            layout->controls[i].rec.y += layout->controls[i].ap->y;
-                                            layout->controls[i].ap = &layout->anchors[0];
+                                            RecordControlChange(&journal, layout, i);
+                                            layout->controls[i].rec.x += layout->anchors[layout->controls[i].anchorId].x;
+                                            layout->controls[i].rec.y += layout->anchors[layout->controls[i].anchorId].y;
+                                            layout->controls[i].anchorId = 0;
                                         }
                                     }
                                 }
                                 else if (IsKeyPressed(KEY_DELETE))      // Delete anchor
                                 {
+                                    RecordAnchorChange(&journal, layout, selectedAnchor);
+
                                     if (selectedAnchor == 0)
                                     {
                                         layout->anchors[selectedAnchor].x = 0;
@@ -1963,11 +2158,12 @@ int main(int argc, char *argv[])
                                     {
                                         for (int i = 0; i < layout->controlCount; i++)
                                         {
-                                            if (layout->controls[i].ap->id == selectedAnchor)
+                                            if (layout->controls[i].anchorId == selectedAnchor)
                                             {
-                                                layout->controls[i].rec.x += layout->controls[i].ap->x;
-                                                layout->controls[i].rec.y += layout->controls[i].ap->y;
-                                                layout->controls[i].ap = &layout->anchors[0];
+                                                RecordControlChange(&journal, layout, i);
+                                                layout->controls[i].rec.x += layout->anchors[layout->controls[i].anchorId].x;
+                                                layout->controls[i].rec.y += layout->anchors[layout->controls[i].anchorId].y;
+                                                layout->controls[i].anchorId = 0;
                                             }
                                         }
 
@@ -1983,8 +2179,10 @@ int main(int argc, char *argv[])
                                 }
                                 else if (IsKeyReleased(KEY_N))          // Enable name edit mode
                                 {
-                                    nameEditMode = true;
                                     strcpy(prevName, layout->anchors[selectedAnchor].name);
+                                    strcpy(editText, prevName);
+                                    textBoxCursorIndex = (int)strlen(editText);
+                                    nameEditMode = true;
                                 }
                             }
                         }
@@ -1998,13 +2196,14 @@ int main(int argc, char *argv[])
 
                         if (focusedControl != -1)
                         {
-                            if (layout->controls[focusedControl].ap->id > 0)
+                            RecordControlChange(&journal, layout, focusedControl);
+                            if (layout->controls[focusedControl].anchorId > 0)
                             {
-                                layout->controls[focusedControl].rec.x += layout->controls[focusedControl].ap->x;
-                                layout->controls[focusedControl].rec.y += layout->controls[focusedControl].ap->y;
+                                layout->controls[focusedControl].rec.x += layout->anchors[layout->controls[focusedControl].anchorId].x;
+                                layout->controls[focusedControl].rec.y += layout->anchors[layout->controls[focusedControl].anchorId].y;
                             }
 
-                            layout->controls[focusedControl].ap = &layout->anchors[selectedAnchor];
+                            layout->controls[focusedControl].anchorId = selectedAnchor;
 
                             if (selectedAnchor> 0)
                             {
@@ -2218,9 +2417,7 @@ int main(int argc, char *argv[])
             strcpy(inFileName, "\0");
             SetWindowTitle(TextFormat("%s v%s", toolName, toolVersion));
 
-            for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
-            currentUndoIndex = 0;
-            firstUndoIndex = 0;
+            CloseJournal(&journal);
 
             resetLayout = false;
         }
@@ -2313,57 +2510,58 @@ int main(int argc, char *argv[])
             GuiLock();
             for (int i = 0; i < layout->controlCount; i++)
             {
-                if (!layout->controls[i].ap->hidding)
+                if (!layout->anchors[layout->controls[i].anchorId].hidding)
                 {
                     Vector2 anchorOffset = (Vector2){ 0, 0 };
-                    if (layout->controls[i].ap->id > 0) anchorOffset = (Vector2){ layout->controls[i].ap->x, layout->controls[i].ap->y };
+                    if (layout->controls[i].anchorId > 0) anchorOffset = (Vector2){ layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y };
                     Rectangle rec = { anchorOffset.x + layout->controls[i].rec.x, anchorOffset.y + layout->controls[i].rec.y, layout->controls[i].rec.width, layout->controls[i].rec.height };
+                    const char *text = GetLayoutString(layout, layout->controlsInfo[i].text);
 
                     switch (layout->controls[i].type)
                     {
                         case GUI_WINDOWBOX:
                         {
                             GuiSetAlpha(0.7f);
-                            GuiWindowBox(rec, layout->controls[i].text);
+                            GuiWindowBox(rec, text);
                             GuiSetAlpha(1.0f);
                         } break;
-                        case GUI_GROUPBOX: GuiGroupBox(rec, layout->controls[i].text); break;
+                        case GUI_GROUPBOX: GuiGroupBox(rec, text); break;
                         case GUI_LINE:
                         {
-                            if (layout->controls[i].text[0] == '\0') GuiLine(rec, NULL);
-                            else GuiLine(rec, layout->controls[i].text);
+                            if (text[0] == '\0') GuiLine(rec, NULL);
+                            else GuiLine(rec, text);
                         } break;
                         case GUI_PANEL:
                         {
                             GuiSetAlpha(0.7f);
-                            GuiPanel(rec, (layout->controls[i].text[0] == '\0')? NULL : layout->controls[i].text);
+                            GuiPanel(rec, (text[0] == '\0')? NULL : text);
                             GuiSetAlpha(1.0f);
                         } break;
-                        case GUI_LABEL: GuiLabel(rec, layout->controls[i].text); break;
-                        case GUI_BUTTON: GuiButton(rec, layout->controls[i].text); break;
-                        case GUI_LABELBUTTON: GuiLabelButton(rec, layout->controls[i].text); break;
-                        case GUI_CHECKBOX: GuiCheckBox(rec, layout->controls[i].text, NULL); break;
-                        case GUI_TOGGLE: GuiToggle(rec, layout->controls[i].text, NULL); break;
-                        case GUI_TOGGLEGROUP: GuiToggleGroup(rec, layout->controls[i].text, NULL); break;
-                        case GUI_COMBOBOX: GuiComboBox(rec, layout->controls[i].text, NULL); break;
-                        case GUI_DROPDOWNBOX: GuiDropdownBox(rec, layout->controls[i].text, &dropdownBoxActive, false); break;
-                        case GUI_TEXTBOX: GuiTextBox(rec, layout->controls[i].text, MAX_CONTROL_TEXT_LENGTH, false); break;
-                        //case GUI_TEXTBOXMULTI: GuiTextBoxMulti(rec, layout->controls[i].text, MAX_CONTROL_TEXT_LENGTH, false); break;
-                        case GUI_VALUEBOX: GuiValueBox(rec, layout->controls[i].text, &valueBoxValue, 42, 100, false); break;
-                        case GUI_SPINNER: GuiSpinner(rec, layout->controls[i].text, &spinnerValue, 42, 3, false); break;
-                        case GUI_SLIDER: GuiSlider(rec, layout->controls[i].text, NULL, NULL, 0, 100); break;
-                        case GUI_SLIDERBAR: GuiSliderBar(rec, layout->controls[i].text, NULL, NULL, 0, 100); break;
-                        case GUI_PROGRESSBAR: GuiProgressBar(rec, layout->controls[i].text, NULL, NULL, 0, 100); break;
-                        case GUI_STATUSBAR: GuiStatusBar(rec, layout->controls[i].text); break;
+                        case GUI_LABEL: GuiLabel(rec, text); break;
+                        case GUI_BUTTON: GuiButton(rec, text); break;
+                        case GUI_LABELBUTTON: GuiLabelButton(rec, text); break;
+                        case GUI_CHECKBOX: GuiCheckBox(rec, text, NULL); break;
+                        case GUI_TOGGLE: GuiToggle(rec, text, NULL); break;
+                        case GUI_TOGGLEGROUP: GuiToggleGroup(rec, text, NULL); break;
+                        case GUI_COMBOBOX: GuiComboBox(rec, text, NULL); break;
+                        case GUI_DROPDOWNBOX: GuiDropdownBox(rec, text, &dropdownBoxActive, false); break;
+                        case GUI_TEXTBOX: GuiTextBox(rec, (char *)text, MAX_CONTROL_TEXT_LENGTH, false); break;
+                        //case GUI_TEXTBOXMULTI: GuiTextBoxMulti(rec, text, MAX_CONTROL_TEXT_LENGTH, false); break;
+                        case GUI_VALUEBOX: GuiValueBox(rec, text, &valueBoxValue, 42, 100, false); break;
+                        case GUI_SPINNER: GuiSpinner(rec, text, &spinnerValue, 42, 3, false); break;
+                        case GUI_SLIDER: GuiSlider(rec, text, NULL, NULL, 0, 100); break;
+                        case GUI_SLIDERBAR: GuiSliderBar(rec, text, NULL, NULL, 0, 100); break;
+                        case GUI_PROGRESSBAR: GuiProgressBar(rec, text, NULL, NULL, 0, 100); break;
+                        case GUI_STATUSBAR: GuiStatusBar(rec, text); break;
                         case GUI_SCROLLPANEL:
                         {
                             GuiSetAlpha(0.7f);
-                            GuiScrollPanel(rec, (layout->controls[i].text[0] == '\0')? NULL : layout->controls[i].text, rec, NULL, NULL);
+                            GuiScrollPanel(rec, (text[0] == '\0')? NULL : text, rec, NULL, NULL);
                             GuiSetAlpha(1.0f);
                         } break;
-                        case GUI_LISTVIEW: GuiListView(rec, layout->controls[i].text, &listViewScrollIndex, &listViewActive); break;
-                        case GUI_COLORPICKER: GuiColorPicker(rec, (layout->controls[i].text[0] == '\0')? NULL : layout->controls[i].text, NULL); break;
-                        case GUI_DUMMYREC: GuiDummyRec(rec, layout->controls[i].text); break;
+                        case GUI_LISTVIEW: GuiListView(rec, text, &listViewScrollIndex, &listViewActive); break;
+                        case GUI_COLORPICKER: GuiColorPicker(rec, (text[0] == '\0')? NULL : text, NULL); break;
+                        case GUI_DUMMYREC: GuiDummyRec(rec, text); break;
                         default: break;
                     }
 
@@ -2381,7 +2579,7 @@ int main(int argc, char *argv[])
             // Draw anchors and related data
             //----------------------------------------------------------------------------------------
             // Draw anchors
-            for (int i = 0; i < MAX_ANCHOR_POINTS; i++)
+            for (int i = 0; i < layout->anchorCapacity; i++)
             {
                 if (layout->anchors[i].enabled)
                 {
@@ -2437,14 +2635,14 @@ int main(int argc, char *argv[])
             {
                 for (int i = 0; i < layout->controlCount; i++)
                 {
-                    if (layout->controls[i].ap->id == focusedAnchor)
+                    if (layout->controls[i].anchorId == focusedAnchor)
                     {
-                        if (focusedAnchor == 0) DrawLine(layout->controls[i].ap->x, layout->controls[i].ap->y, layout->controls[i].rec.x, layout->controls[i].rec.y, colAnchorLinkLine0);
-                        else if (!layout->controls[i].ap->hidding)
+                        if (focusedAnchor == 0) DrawLine(layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y, layout->controls[i].rec.x, layout->controls[i].rec.y, colAnchorLinkLine0);
+                        else if (!layout->anchors[layout->controls[i].anchorId].hidding)
                         {
-                            DrawLine(layout->controls[i].ap->x, layout->controls[i].ap->y, layout->controls[i].ap->x + layout->controls[i].rec.x, layout->controls[i].ap->y + layout->controls[i].rec.y, colAnchorLinkLine);
+                            DrawLine(layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y, layout->anchors[layout->controls[i].anchorId].x + layout->controls[i].rec.x, layout->anchors[layout->controls[i].anchorId].y + layout->controls[i].rec.y, colAnchorLinkLine);
                         }
-                        else DrawLine(layout->controls[i].ap->x, layout->controls[i].ap->y, layout->controls[i].ap->x + layout->controls[i].rec.x, layout->controls[i].ap->y + layout->controls[i].rec.y, colAnchorLinkLineHidden);
+                        else DrawLine(layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y, layout->anchors[layout->controls[i].anchorId].x + layout->controls[i].rec.x, layout->anchors[layout->controls[i].anchorId].y + layout->controls[i].rec.y, colAnchorLinkLineHidden);
                     }
                 }
             }
@@ -2454,14 +2652,14 @@ int main(int argc, char *argv[])
             {
                 for (int i = 0; i < layout->controlCount; i++)
                 {
-                    if (layout->controls[i].ap->id == selectedAnchor)
+                    if (layout->controls[i].anchorId == selectedAnchor)
                     {
-                        if (selectedAnchor == 0) DrawLine(layout->controls[i].ap->x, layout->controls[i].ap->y, layout->controls[i].rec.x, layout->controls[i].rec.y, Fade(colAnchorLinkLine0, 0.5f));
-                        else if (!layout->controls[i].ap->hidding)
+                        if (selectedAnchor == 0) DrawLine(layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y, layout->controls[i].rec.x, layout->controls[i].rec.y, Fade(colAnchorLinkLine0, 0.5f));
+                        else if (!layout->anchors[layout->controls[i].anchorId].hidding)
                         {
-                            DrawLine(layout->controls[i].ap->x, layout->controls[i].ap->y, layout->controls[i].ap->x + layout->controls[i].rec.x, layout->controls[i].ap->y + layout->controls[i].rec.y, colAnchorLinkLine);
+                            DrawLine(layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y, layout->anchors[layout->controls[i].anchorId].x + layout->controls[i].rec.x, layout->anchors[layout->controls[i].anchorId].y + layout->controls[i].rec.y, colAnchorLinkLine);
                         }
-                        else DrawLine(layout->controls[i].ap->x, layout->controls[i].ap->y, layout->controls[i].ap->x + layout->controls[i].rec.x, layout->controls[i].ap->y + layout->controls[i].rec.y, colAnchorLinkLine0);
+                        else DrawLine(layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y, layout->anchors[layout->controls[i].anchorId].x + layout->controls[i].rec.x, layout->anchors[layout->controls[i].anchorId].y + layout->controls[i].rec.y, colAnchorLinkLine0);
                     }
                 }
             }
@@ -2602,13 +2800,21 @@ int main(int argc, char *argv[])
                         DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Fade(colEditAnchorNameOverlay, 0.2f));
 
                         int fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE)*2;
-                        int textWidth = MeasureText(layout->anchors[selectedAnchor].name, fontSize);
+                        int textWidth = MeasureText(editText, fontSize);
                         Rectangle textboxRec = (Rectangle){ layout->anchors[selectedAnchor].x, layout->anchors[selectedAnchor].y, textWidth + 40, fontSize + 5 };
 
                         if (textboxRec.width < (textWidth + 40)) textboxRec.width = (float)textWidth + 40;
                         if (textboxRec.height < fontSize) textboxRec.height += fontSize;
 
-                        if (GuiTextBox(textboxRec, layout->anchors[selectedAnchor].name, MAX_ANCHOR_NAME_LENGTH, nameEditMode)) nameEditMode = !nameEditMode;
+                        if (GuiTextBox(textboxRec, editText, MAX_ANCHOR_NAME_LENGTH, nameEditMode)) nameEditMode = !nameEditMode;
+
+                        // Update anchor name on changes
+                        if (!TextIsEqual(editText, layout->anchors[selectedAnchor].name))
+                        {
+                            RecordAnchorChange(&journal, layout, selectedAnchor);
+                            memset(layout->anchors[selectedAnchor].name, 0, MAX_ANCHOR_NAME_LENGTH);
+                            strcpy(layout->anchors[selectedAnchor].name, editText);
+                        }
                     }
                 }
 
@@ -2629,16 +2835,16 @@ int main(int argc, char *argv[])
                     }
 
                     // WARNING: Adding offset to control rectangle draw in screen coordinates
-                    if (layout->controls[selectedControl].ap->id > 0)
+                    if (layout->controls[selectedControl].anchorId > 0)
                     {
-                        selectedRec.x += layout->controls[selectedControl].ap->x;
-                        selectedRec.y += layout->controls[selectedControl].ap->y;
+                        selectedRec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                        selectedRec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
                     }
 
                     DrawRectangleRec(selectedRec, Fade(colControl, 0.3f));
 
                     // Control Link
-                    if (layout->controls[selectedControl].ap->id > 0) DrawLine(layout->controls[selectedControl].ap->x, layout->controls[selectedControl].ap->y, selectedRec.x, selectedRec.y, colAnchorLinkLine);
+                    if (layout->controls[selectedControl].anchorId > 0) DrawLine(layout->anchors[layout->controls[selectedControl].anchorId].x, layout->anchors[layout->controls[selectedControl].anchorId].y, selectedRec.x, selectedRec.y, colAnchorLinkLine);
 
                     // Linking
                     if (anchorLinkMode) DrawLine(selectedRec.x, selectedRec.y, mouse.x, mouse.y, colAnchorLinkLine);
@@ -2651,7 +2857,7 @@ int main(int argc, char *argv[])
 
                     if (!showGlobalPosition)
                     {
-                        if (layout->controls[selectedControl].ap->id > 0)
+                        if (layout->controls[selectedControl].anchorId > 0)
                         {
                             DrawText(TextFormat("[%i, %i, %i, %i]",
                                 (int)(layout->controls[selectedControl].rec.x),
@@ -2686,7 +2892,7 @@ int main(int argc, char *argv[])
 
                         // Make sure text could be written, no matter if overflows control
                         int fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
-                        int textWidth = MeasureText(layout->controls[selectedControl].text, fontSize);
+                        int textWidth = MeasureText(editText, fontSize);
                         if (textboxRec.width < (textWidth + 40)) textboxRec.width = textWidth + 40;
                         if (textboxRec.height < fontSize) textboxRec.height += fontSize;
 
@@ -2697,21 +2903,21 @@ int main(int argc, char *argv[])
                             textboxRec.height = GuiGetStyle(DEFAULT, TEXT_SIZE)*2.0f;
                         }
 
-                        if (layout->controls[selectedControl].ap->id > 0)
+                        if (layout->controls[selectedControl].anchorId > 0)
                         {
-                            textboxRec.x += layout->controls[selectedControl].ap->x;
-                            textboxRec.y += layout->controls[selectedControl].ap->y;
+                            textboxRec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                            textboxRec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
                         }
 
                         // Draw a GuiTextBox() for text edition
                         if (layout->controls[selectedControl].type == GUI_TEXTBOXMULTI)
                         {
-                            //if (GuiTextBoxMulti(textboxRec, layout->controls[selectedControl].text, MAX_CONTROL_TEXT_LENGTH, textEditMode)) textEditMode = !textEditMode;
+                            //if (GuiTextBoxMulti(textboxRec, layout->controlsInfo[selectedControl].text, MAX_CONTROL_TEXT_LENGTH, textEditMode)) textEditMode = !textEditMode;
                         }
-                        else if (GuiTextBox(textboxRec, layout->controls[selectedControl].text, MAX_CONTROL_TEXT_LENGTH, textEditMode)) textEditMode = !textEditMode;
+                        else if (GuiTextBox(textboxRec, editText, MAX_CONTROL_TEXT_LENGTH, textEditMode)) textEditMode = !textEditMode;
 
                         // Check if icon panel must be shown
-                        if ((strlen(layout->controls[selectedControl].text) == 1) && (layout->controls[selectedControl].text[0] == '#'))
+                        if ((strlen(editText) == 1) && (editText[0] == '#'))
                         {
                             showIconPanel = true;
 
@@ -2719,13 +2925,20 @@ int main(int argc, char *argv[])
                             GuiToggleGroup((Rectangle){ (int)textboxRec.x, (int)textboxRec.y + (int)textboxRec.height + 10, 18, 18 }, toggleIconsText, &selectedIcon);
                             if (selectedIcon > 0)
                             {
-                                strcpy(layout->controls[selectedControl].text, TextFormat("#%03i#\0", selectedIcon));
-                                textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].text);
+                                strcpy(editText, TextFormat("#%03i#\0", selectedIcon));
+                                textBoxCursorIndex = (int)strlen(editText);
                                 showIconPanel = false;
                                 textEditMode = true;
                                 selectedIcon = 0;
                             }
                         }
+
+                        // Update control text in layout strings pool on changes
+                        if (!TextIsEqual(editText, GetLayoutString(layout, layout->controlsInfo[selectedControl].text)))
+                        {
+                            RecordControlChange(&journal, layout, selectedControl);
+                            layout->controlsInfo[selectedControl].text = AddLayoutString(layout, editText, (int)strlen(editText));
+                        }
                     }
 
                     // Name edit
@@ -2736,7 +2949,7 @@ int main(int argc, char *argv[])
                         Rectangle textboxRec = layout->controls[selectedControl].rec;
 
                         int fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
-                        int textWidth = MeasureText(layout->controls[selectedControl].name, fontSize);
+                        int textWidth = MeasureText(editText, fontSize);
                         if (textboxRec.width < textWidth + 40) textboxRec.width = textWidth + 40;
                         if (textboxRec.height < fontSize) textboxRec.height += fontSize;
 
@@ -2747,13 +2960,20 @@ int main(int argc, char *argv[])
                             textboxRec.height = GuiGetStyle(DEFAULT, TEXT_SIZE)*2.0f;
                         }
 
-                        if (layout->controls[selectedControl].ap->id > 0)
+                        if (layout->controls[selectedControl].anchorId > 0)
                         {
-                            textboxRec.x += layout->controls[selectedControl].ap->x;
-                            textboxRec.y += layout->controls[selectedControl].ap->y;
+                            textboxRec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                            textboxRec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
                         }
 
-                        if (GuiTextBox(textboxRec, layout->controls[selectedControl].name, MAX_CONTROL_NAME_LENGTH, nameEditMode)) nameEditMode = !nameEditMode;
+                        if (GuiTextBox(textboxRec, editText, MAX_CONTROL_NAME_LENGTH, nameEditMode)) nameEditMode = !nameEditMode;
+
+                        // Update control name in layout strings pool on changes
+                        if (!TextIsEqual(editText, GetLayoutString(layout, layout->controlsInfo[selectedControl].name)))
+                        {
+                            RecordControlChange(&journal, layout, selectedControl);
+                            layout->controlsInfo[selectedControl].name = AddLayoutString(layout, editText, (int)strlen(editText));
+                        }
                     }
                 }
 
@@ -2772,19 +2992,19 @@ int main(int argc, char *argv[])
                     }
 
                     // WARNING: Adding offset to control rectangle draw in screen coordinates
-                    if (layout->controls[focusedControl].ap->id > 0)
+                    if (layout->controls[focusedControl].anchorId > 0)
                     {
-                        focusedRec.x += layout->controls[focusedControl].ap->x;
-                        focusedRec.y += layout->controls[focusedControl].ap->y;
+                        focusedRec.x += layout->anchors[layout->controls[focusedControl].anchorId].x;
+                        focusedRec.y += layout->anchors[layout->controls[focusedControl].anchorId].y;
                     }
 
                     if (focusedControl != selectedControl) DrawRectangleRec(focusedRec, Fade(colControlFocused, 0.1f));
 
                     DrawRectangleLinesEx(focusedRec, 1, colControlFocused);
 
-                    if (layout->controls[focusedControl].ap->id > 0)
+                    if (layout->controls[focusedControl].anchorId > 0)
                     {
-                        DrawLine(layout->controls[focusedControl].ap->x, layout->controls[focusedControl].ap->y, focusedRec.x, focusedRec.y, colAnchorLinkLine);
+                        DrawLine(layout->anchors[layout->controls[focusedControl].anchorId].x, layout->anchors[layout->controls[focusedControl].anchorId].y, focusedRec.x, focusedRec.y, colAnchorLinkLine);
                     }
 
                     // Draw control focused text coordinates
@@ -2795,7 +3015,7 @@ int main(int argc, char *argv[])
 
                     if (!showGlobalPosition)
                     {
-                        if (layout->controls[focusedControl].ap->id > 0)
+                        if (layout->controls[focusedControl].anchorId > 0)
                         {
                             DrawText(TextFormat("[%i, %i, %i, %i]",
                                 (int)(layout->controls[focusedControl].rec.x),
@@ -2828,10 +3048,10 @@ int main(int argc, char *argv[])
                     Rectangle rec = layout->controls[selectedControl].rec;
 
                     // NOTE: Anchor offset must be considered
-                    if (layout->controls[selectedControl].ap->id > 0)
+                    if (layout->controls[selectedControl].anchorId > 0)
                     {
-                        rec.x += layout->controls[selectedControl].ap->x;
-                        rec.y += layout->controls[selectedControl].ap->y;
+                        rec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                        rec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
                     }
 
                     DrawRectangleLinesEx(rec, 2, colControlSelected);
@@ -2851,16 +3071,16 @@ int main(int argc, char *argv[])
                 {
                     for (int i = layout->controlCount - 1; i >= 0; i--)
                     {
-                        if (layout->controls[i].ap->id > 0)
+                        if (layout->controls[i].anchorId > 0)
                         {
-                            DrawTextEx(GuiGetFont(), TextFormat("[%i]", layout->controls[i].id),
-                                (Vector2){ layout->controls[i].rec.x + layout->controls[i].ap->x + layout->controls[i].rec.width,
-                                layout->controls[i].rec.y + layout->controls[i].ap->y - GuiGetStyle(DEFAULT, TEXT_SIZE) },
+                            DrawTextEx(GuiGetFont(), TextFormat("[%i]", layout->controlsInfo[i].id),
+                                (Vector2){ layout->controls[i].rec.x + layout->anchors[layout->controls[i].anchorId].x + layout->controls[i].rec.width,
+                                layout->controls[i].rec.y + layout->anchors[layout->controls[i].anchorId].y - GuiGetStyle(DEFAULT, TEXT_SIZE) },
                                 GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), GetColor(GuiGetStyle(LABEL, TEXT_COLOR_PRESSED)));
                         }
                         else
                         {
-                            DrawTextEx(GuiGetFont(), TextFormat("[%i]", layout->controls[i].id),
+                            DrawTextEx(GuiGetFont(), TextFormat("[%i]", layout->controlsInfo[i].id),
                                 (Vector2){ layout->controls[i].rec.x + layout->controls[i].rec.width, layout->controls[i].rec.y - GuiGetStyle(DEFAULT, TEXT_SIZE) },
                                 GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), GetColor(GuiGetStyle(LABEL, TEXT_COLOR_PRESSED)));
                         }
@@ -2880,7 +3100,7 @@ int main(int argc, char *argv[])
                         if ((type == GUI_CHECKBOX) || (type == GUI_LABEL) || (type == GUI_SLIDER) || (type == GUI_SLIDERBAR))
                         {
                             int fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
-                            int textWidth = MeasureText(layout->controls[i].name, fontSize);
+                            int textWidth = MeasureText(GetLayoutString(layout, layout->controlsInfo[i].name), fontSize);
                             if (textboxRec.width < textWidth + 20) textboxRec.width = textWidth + 20;
                             if (textboxRec.height < fontSize) textboxRec.height += fontSize;
                         }
@@ -2892,14 +3112,14 @@ int main(int argc, char *argv[])
                             textboxRec.height = GuiGetStyle(DEFAULT, TEXT_SIZE)*2;
                         }
 
-                        if (layout->controls[i].ap->id > 0)
+                        if (layout->controls[i].anchorId > 0)
                         {
-                            textboxRec.x += layout->controls[i].ap->x;
-                            textboxRec.y += layout->controls[i].ap->y;
+                            textboxRec.x += layout->anchors[layout->controls[i].anchorId].x;
+                            textboxRec.y += layout->anchors[layout->controls[i].anchorId].y;
                         }
 
                         DrawRectangleRec(textboxRec, colEditControlNameBackRec);
-                        GuiTextBox(textboxRec, layout->controls[i].name, MAX_CONTROL_NAME_LENGTH, false);
+                        GuiTextBox(textboxRec, (char *)GetLayoutString(layout, layout->controlsInfo[i].name), MAX_CONTROL_NAME_LENGTH, false);
                     }
 
                     for (int i = 0; i < layout->anchorCount; i++)
@@ -2955,32 +3175,38 @@ int main(int argc, char *argv[])
             // Control: Enable text edit mode if required
             if (mainToolbarState.btnEditTextPressed)
             {
-                strcpy(prevText, layout->controls[selectedControl].text);
-                textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].text);
+                strcpy(prevText, GetLayoutString(layout, layout->controlsInfo[selectedControl].text));
+                strcpy(editText, prevText);
+                textBoxCursorIndex = (int)strlen(editText);
                 textEditMode = true;
             }
 
             // Control: Enable name edit mode if required
             if (mainToolbarState.btnEditNamePressed)
             {
-                strcpy(prevName, layout->controls[selectedControl].name);
-                textBoxCursorIndex = (int)strlen(layout->controls[selectedControl].name);
+                strcpy(prevName, GetLayoutString(layout, layout->controlsInfo[selectedControl].name));
+                strcpy(editText, prevName);
+                textBoxCursorIndex = (int)strlen(editText);
                 nameEditMode = true;
             }
 
             // Control: Duplicate selected control if required
             if (mainToolbarState.btnDuplicateControlPressed)
             {
-                layout->controls[layout->controlCount].id = layout->controlCount;
+                ReserveLayoutControls(layout, layout->controlCount + 1);
+
+                layout->controlsInfo[layout->controlCount].id = layout->controlCount;
                 layout->controls[layout->controlCount].type = layout->controls[selectedControl].type;
                 layout->controls[layout->controlCount].rec = layout->controls[selectedControl].rec;
                 layout->controls[layout->controlCount].rec.x += 10;
                 layout->controls[layout->controlCount].rec.y += 10;
-                strcpy(layout->controls[layout->controlCount].text, layout->controls[selectedControl].text);
-                strcpy(layout->controls[layout->controlCount].name, TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount));
-                layout->controls[layout->controlCount].ap = layout->controls[selectedControl].ap;            // Default anchor point (0, 0)
+                layout->controlsInfo[layout->controlCount].text = layout->controlsInfo[selectedControl].text;     // NOTE: Strings are interned, reference is shared
+                const char *controlName = TextFormat("%s%03i", controlTypeName[layout->controls[layout->controlCount].type], layout->controlCount);
+                layout->controlsInfo[layout->controlCount].name = AddLayoutString(layout, controlName, (int)strlen(controlName));
+                layout->controls[layout->controlCount].anchorId = layout->controls[selectedControl].anchorId;            // Default anchor point (0, 0)
 
                 layout->controlCount++;
+                RecordControlCreate(&journal, layout, layout->controlCount - 1);
 
                 selectedControl = layout->controlCount - 1;
             }
@@ -2988,12 +3214,12 @@ int main(int argc, char *argv[])
             // Control: Unlink from anchor
             if (mainToolbarState.btnUnlinkControlPressed)
             {
-                if (layout->controls[selectedControl].ap->id != 0)
+                if (layout->controls[selectedControl].anchorId != 0)
                 {
-
-                    layout->controls[selectedControl].rec.x += layout->controls[selectedControl].ap->x;
-                    layout->controls[selectedControl].rec.y += layout->controls[selectedControl].ap->y;
-                    layout->controls[selectedControl].ap = &layout->anchors[0];  // Link to default work area anchor
+                    RecordControlChange(&journal, layout, selectedControl);
+                    layout->controls[selectedControl].rec.x += layout->anchors[layout->controls[selectedControl].anchorId].x;
+                    layout->controls[selectedControl].rec.y += layout->anchors[layout->controls[selectedControl].anchorId].y;
+                    layout->controls[selectedControl].anchorId = 0;  // Link to default work area anchor
                 }
             }
 
@@ -3002,18 +3228,8 @@ int main(int argc, char *argv[])
             {
                 mouseScaleReady = false;
 
-                for (int i = selectedControl; i < layout->controlCount; i++)
-                {
-                    layout->controls[i].type = layout->controls[i + 1].type;
-                    layout->controls[i].rec = layout->controls[i + 1].rec;
-                    memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-                    memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-                    strcpy(layout->controls[i].text, layout->controls[i + 1].text);
-                    strcpy(layout->controls[i].name, layout->controls[i + 1].name);
-                    layout->controls[i].ap = layout->controls[i + 1].ap;
-                }
-
-                layout->controlCount--;
+                RecordControlDelete(&journal, layout, selectedControl);
+                DeleteLayoutControl(layout, selectedControl);
                 focusedControl = -1;
                 selectedControl = -1;
             }
@@ -3022,22 +3238,29 @@ int main(int argc, char *argv[])
             if (mainToolbarState.btnEditAnchorNamePressed)
             {
                 strcpy(prevName, layout->anchors[selectedAnchor].name);
+                strcpy(editText, prevName);
+                textBoxCursorIndex = (int)strlen(editText);
                 nameEditMode = true;
             }
 
             // Anchor: Set current view mode
-            if (selectedAnchor != -1) layout->anchors[selectedAnchor].hidding = mainToolbarState.hideAnchorControlsActive;
+            if ((selectedAnchor != -1) && (layout->anchors[selectedAnchor].hidding != mainToolbarState.hideAnchorControlsActive))
+            {
+                RecordAnchorChange(&journal, layout, selectedAnchor);
+                layout->anchors[selectedAnchor].hidding = mainToolbarState.hideAnchorControlsActive;
+            }
 
             // Anchor: Unlink all linked controls
             if (mainToolbarState.btnUnlinkAnchorControlsPressed)
             {
                 for (int i = 0; i < layout->controlCount; i++)
                 {
-                    if (layout->controls[i].ap->id == selectedAnchor)
+                    if (layout->controls[i].anchorId == selectedAnchor)
                     {
-                        layout->controls[i].rec.x += layout->controls[i].ap->x;
-                        layout->controls[i].rec.y += layout->controls[i].ap->y;
-                        layout->controls[i].ap = &layout->anchors[0];
+                        RecordControlChange(&journal, layout, i);
+                        layout->controls[i].rec.x += layout->anchors[layout->controls[i].anchorId].x;
+                        layout->controls[i].rec.y += layout->anchors[layout->controls[i].anchorId].y;
+                        layout->controls[i].anchorId = 0;
                     }
                 }
             }
@@ -3045,6 +3268,8 @@ int main(int argc, char *argv[])
             // Anchor: Delete if required
             if (mainToolbarState.btnDeleteAnchorPressed)
             {
+                RecordAnchorChange(&journal, layout, selectedAnchor);
+
                 if (selectedAnchor == 0)
                 {
                     layout->anchors[0].x = 0;
@@ -3055,11 +3280,12 @@ int main(int argc, char *argv[])
                 {
                     for (int i = 0; i < layout->controlCount; i++)
                     {
-                        if (layout->controls[i].ap->id == selectedAnchor)
+                        if (layout->controls[i].anchorId == selectedAnchor)
                         {
-                            layout->controls[i].rec.x += layout->controls[i].ap->x;
-                            layout->controls[i].rec.y += layout->controls[i].ap->y;
-                            layout->controls[i].ap = &layout->anchors[0];
+                            RecordControlChange(&journal, layout, i);
+                            layout->controls[i].rec.x += layout->anchors[layout->controls[i].anchorId].x;
+                            layout->controls[i].rec.y += layout->anchors[layout->controls[i].anchorId].y;
+                            layout->controls[i].anchorId = 0;
                         }
                     }
 
@@ -3129,13 +3355,13 @@ int main(int argc, char *argv[])
                         (int)layout->controls[selectedControl].rec.x, (int)layout->controls[selectedControl].rec.y,
                         (int)layout->controls[selectedControl].rec.width, (int)layout->controls[selectedControl].rec.height,
                         TextToUpper(controlTypeName[layout->controls[selectedControl].type]),
-                        layout->controls[selectedControl].name));
+                        GetLayoutString(layout, layout->controlsInfo[selectedControl].name)));
             }
             else if (selectedAnchor != -1)
             {
                 // Count controls linked to an anchor
                 int count = 0;
-                for (int i = 0; i < layout->controlCount; i++) if (layout->controls[i].ap->id == layout->anchors[selectedAnchor].id) count++;
+                for (int i = 0; i < layout->controlCount; i++) if (layout->controls[i].anchorId == layout->anchors[selectedAnchor].id) count++;
 
                 GuiStatusBar((Rectangle){ 160 + 168 - 2, GetScreenHeight() - 24, 600, 24 },
                     TextFormat("SELECTED ANCHOR: %02i  (%i, %i) | CONTROLS: %03i | %s", selectedAnchor,
@@ -3218,8 +3444,17 @@ int main(int argc, char *argv[])
             {
                 if (windowCodegenState.customTemplateLoaded)
                 {
+                    // Wait for code generation worker, custom template could be in use
+                    if (codegenWorker.active)
+                    {
+                        RL_FREE(windowCodegenState.codeText);
+                        windowCodegenState.codeText = WaitCodegenWorker(&codegenWorker);
+                    }
+
                     UnloadFileText(windowCodegenState.customTemplate);
                     windowCodegenState.customTemplate = NULL;
+                    UnloadCodeTemplate(codeTemplates[4]);
+                    codeTemplates[4] = (GuiCodeTemplate){ 0 };
                     windowCodegenState.customTemplateLoaded = false;
                 }
                 else showLoadTemplateDialog = true;
@@ -3227,7 +3462,8 @@ int main(int argc, char *argv[])
 
             if (windowCodegenState.btnExportCodePressed)
             {
-                if (windowCodegenState.codeTemplateActive == 1) strcpy(outFileName, TextFormat("gui_%s.h", guiConfig.name));
+                if ((windowCodegenState.codeTemplateActive == 1) || (windowCodegenState.codeTemplateActive == 2)) strcpy(outFileName, TextFormat("gui_%s.h", guiConfig.name));
+                else if (windowCodegenState.codeTemplateActive == 3) strcpy(outFileName, TextFormat("gui_%s.hpp", guiConfig.name));
                 else strcpy(outFileName, TextFormat("%s.c", guiConfig.name));
 
                 showExportFileDialog = true;
@@ -3291,15 +3527,11 @@ int main(int argc, char *argv[])
 
                     if (tempLayout != NULL)
                     {
-                        memcpy(layout, tempLayout, sizeof(GuiLayout));
+                        // NOTE: Controls anchor references are relinked to layout anchors on copy
+                        CopyLayout(layout, tempLayout);
 
-                        // WARNING: When layout is loaded, anchor object references are not set, they must be reset manually
-                        for (int i = 0; i < layout->controlCount; i++) layout->controls[i].ap = &layout->anchors[tempLayout->controls[i].ap->id];
-
-                        // Reinit undo levels for new layout
-                        for (int i = 0; i < MAX_UNDO_LEVELS; i++) memcpy(&undoLayouts[i], layout, sizeof(GuiLayout));
-                        currentUndoIndex = 0;
-                        firstUndoIndex = 0;
+                        // Open undo history for new layout
+                        OpenJournal(&journal, layout, inFileName);
 
                         UnloadLayout(tempLayout);
 
@@ -3330,10 +3562,8 @@ int main(int argc, char *argv[])
                     if (!IsFileNameValid(GetFileName(outFileName))) strcpy(outFileName, "layout.rgl");
                     if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgl")) strcat(outFileName, ".rgl\0");
 
-                    GuiLayout outLayout = { 0 };
-                    memcpy(&outLayout, layout, sizeof(GuiLayout));
-
-                    SaveLayout(&outLayout, outFileName);
+                    SaveLayout(layout, outFileName, saveBinaryLayout);
+                    SaveJournal(&journal, layout, outFileName);
 
                     strcpy(inFileName, outFileName);
                     SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
@@ -3361,19 +3591,49 @@ int main(int argc, char *argv[])
 #if defined(CUSTOM_MODAL_DIALOGS)
                 int result = GuiFileDialog(DIALOG_TEXTINPUT, "#7#Export layout as code file...", outFileName, "Ok;Cancel", NULL);
 #else
-                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Export layout as code file...", outFileName, "*.c;*.h", "Code Files");
+                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Export layout as code file...", outFileName, "*.c;*.h;*.hpp", "Code Files");
 #endif
                 if (result == 1)
                 {
                     // Check for valid extension and make sure it is
                     if (!IsFileNameValid(GetFileName(outFileName))) strcpy(outFileName, "layout_code.c");
                     if ((GetFileExtension(outFileName) == NULL) ||
-                        (!IsFileExtension(outFileName, ".c") && !IsFileExtension(outFileName, ".h"))) strcat(outFileName, ".h\0");
+                        (!IsFileExtension(outFileName, ".c") && !IsFileExtension(outFileName, ".h") && !IsFileExtension(outFileName, ".hpp"))) strcat(outFileName, ".h\0");
+
+                    // Wait for code generation worker, exported code must include latest changes
+                    // NOTE: Changes coalesced while worker was busy are generated before export
+                    if (codegenWorker.active)
+                    {
+                        RL_FREE(windowCodegenState.codeText);
+                        windowCodegenState.codeText = WaitCodegenWorker(&codegenWorker);
+                    }
+
+                    if ((memcmp(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig)) != 0) || (codeLayoutGeneration != layout->generation))
+                    {
+                        GuiCodeTemplate *codeTemplate = &codeTemplates[windowCodegenState.codeTemplateActive];
+                        if (codeTemplate->text != guiConfig.template)
+                        {
+                            UnloadCodeTemplate(*codeTemplate);
+                            *codeTemplate = LoadCodeTemplate(guiConfig.template);
+                        }
+
+                        StartCodegenWorker(&codegenWorker, layout, codeTemplate, guiConfig);
+                        RL_FREE(windowCodegenState.codeText);
+                        windowCodegenState.codeText = WaitCodegenWorker(&codegenWorker);
+
+                        memcpy(&prevGuiConfig, &guiConfig, sizeof(GuiLayoutConfig));
+                        codeLayoutGeneration = layout->generation;
+                    }
 
                     // Write code string to file
+                    // NOTE: Code is written as is, it could contain format specifiers (i.e. '%' in controls text)
                     FILE *ftool = fopen(outFileName, "wt");
-                    fprintf(ftool, windowCodegenState.codeText);
-                    fclose(ftool);
+
+                    if (ftool != NULL)
+                    {
+                        if (windowCodegenState.codeText != NULL) fputs(windowCodegenState.codeText, ftool);
+                        fclose(ftool);
+                    }
 
                 #if defined(PLATFORM_WEB)
                     // Download file from MEMFS (emscripten memory filesystem)
@@ -3454,8 +3714,12 @@ int main(int argc, char *argv[])
     UnloadLayout(layout);                   // Unload raygui layout
     UnloadTexture(tracemap.texture);        // Unload tracemap texture (if loaded)
 
-    RL_FREE(undoLayouts);                   // Free undo layouts array
+    UnloadJournal(&journal);                // Unload layout journal (undo history)
+    UnloadSpatialIndex(&spatialIndex);      // Unload controls spatial index
+    UnloadCodegenWorker(&codegenWorker);    // Unload code generation worker (running generation is waited)
     RL_FREE(windowCodegenState.codeText);   // Free loaded codeText memory
+    for (int i = 0; i < 5; i++) UnloadCodeTemplate(codeTemplates[i]); // Unload compiled code templates
+    UnloadCodeVariables();                  // Unload code templates variables registry
 
 #if defined(PLATFORM_DESKTOP)
     // Save application init configuration for next run
@@ -3491,6 +3755,7 @@ int main(int argc, char *argv[])
 
     return 0;
 }
+#endif // !RGUILAYOUT_NO_MAIN
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -3512,16 +3777,29 @@ static void ShowCommandLineInfo(void)
 
     printf("USAGE:\n\n");
     printf("    > rguilayout [--help] --input <filename.ext> [--output <filename.ext>]\n");
-    printf("                 [--format <styleformat>] [--edit-prop <property> <value>]\n");
+    printf("                 [--template <filename.ext>] [--format <layoutformat>]\n");
+    printf("                 [--define <KEY=VALUE>] [--table|--cpp]\n");
+    printf("    > rguilayout --input <filename.ext|directory|@filelist> [...] [--output-dir <directory>]\n");
+    printf("                 [--output-pattern <pattern>] [--jobs <count>] [--stamp] [--depfile <filename.d>]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
+    printf("    -i, --input <filename.ext>      : Define input file(s), directories or response files (@filelist).\n");
     printf("                                      Supported extensions: .rgl\n");
-    printf("    -o, --output <filename.ext>     : Define output file.\n");
-    printf("                                      Supported extensions: .c, .h\n");
+    printf("    -o, --output <filename.ext>     : Define output file (single input).\n");
+    printf("                                      Supported extensions: .c, .h, .hpp, .rgl\n");
+    printf("    -O, --output-dir <directory>    : Define output directory (multiple inputs), created if missing.\n");
+    printf("    -p, --output-pattern <pattern>  : Define output file name pattern (multiple inputs).\n");
+    printf("                                      {name} is replaced by input file name, default: {name}.c\n");
+    printf("    -j, --jobs <count>              : Define worker threads for multiple inputs, default: 1\n");
+    printf("    -s, --stamp                     : Skip up to date outputs using inputs hash stamp files (<output>.stamp).\n");
+    printf("                                      NOTE: Unchanged outputs are never rewritten (modification time kept)\n");
+    printf("        --depfile <filename.d>      : Save dependencies file (Make/Ninja), {name} saves one file per output.\n");
+    printf("    -f, --format <layoutformat>     : Define layout output format, only for .rgl output.\n");
+    printf("                                      Supported values: text (default), binary\n");
     printf("    -t, --template <filename.ext>   : Define code template for output.\n");
-    printf("                                      Supported extensions: .c, .h\n\n");
+    printf("                                      Supported extensions: .c, .h\n");
+    printf("    -D, --define <KEY=VALUE>        : Define user template variable, used as $(KEY).\n\n");
     printf("    -n, --name <value>              : Define the output name.\n");
     printf("    -v, --version <value>           : Define the version.\n");
     printf("    -c, --company <value>           : Define the company.\n");
@@ -3529,20 +3807,37 @@ static void ShowCommandLineInfo(void)
     printf("        --no-anchors                : Do not export anchors.\n");
     printf("        --rectangles                : Export rectangles.\n");
     printf("        --no-comments               : Do not export full comments.\n");
+    printf("        --cache-static              : Cache static controls into render texture (.c/.h templates).\n");
+    printf("        --table                     : Use table template (data-driven, .h), if no template defined.\n");
+    printf("        --cpp                       : Use constexpr C++ template (C++20, .hpp), if no template defined.\n");
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rguilayout --input mytool.rgl --output mytools.h\n");
+    printf("    > rguilayout --input mytool.rgl --output mytool_bin.rgl --format binary\n");
+    printf("    > rguilayout --input mytool.rgl --output mytool.c --template mytemplate.c -D BUILD_DATE=2022-10-01\n");
+    printf("    > rguilayout --input mytool.rgl --output gui_mytool.h --table\n");
+    printf("    > rguilayout --input mytool.rgl --output gui_mytool.hpp --cpp\n");
+    printf("    > rguilayout --input layouts/ --output-dir src --output-pattern gui_{name}.h --table -j 8\n");
+    printf("    > rguilayout @layouts.txt --output-dir build/gui -j 4\n");
+    printf("    > rguilayout --input mytool.rgl --output gui_mytool.h --table --stamp --depfile gui_mytool.d\n");
 }
 
 // Process command line input
-static void ProcessCommandLine(int argc, char *argv[])
+// NOTE: Multiple input layouts are processed as a batch, a failed input does not abort the batch
+static int ProcessCommandLine(int argc, char *argv[])
 {
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
 
     char templateFile[512] = { 0 };     // Template file name
+    char outputDir[256] = { 0 };        // Output directory (multiple inputs)
+    char outputPattern[256] = { 0 };    // Output file name pattern (multiple inputs), {name} replaced by input file name
 
-    //int outputFormat = 0;               // Supported output formats
+    bool outputBinary = false;          // Layout output format (.rgl): text or binary
+    int threadCount = 1;                // Worker threads for processing
+    bool useStamps = false;             // Use hash stamp files to skip up to date outputs
+    char depFile[512] = { 0 };          // Dependencies file name (Make/Ninja depfile)
+    unsigned long long definesHash = 14695981039346656037ull;   // User template variables hash (FNV-1a offset basis)
 
     const char *cliName = NULL;
     const char *cliVersion = NULL;
@@ -3551,6 +3846,11 @@ static void ProcessCommandLine(int argc, char *argv[])
     bool cliNoAnchors = false;
     bool cliRecs = false;
     bool cliNoComments = false;
+    bool cliCacheStatic = false;
+    bool cliTable = false;
+    bool cliConstexpr = false;
+
+    CliJobBatch batch = { 0 };
 
     // Process command line arguments
     for (int i = 1; i < argc; i++)
@@ -3561,25 +3861,29 @@ static void ProcessCommandLine(int argc, char *argv[])
         }
         else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
         {
-            // Check for valid argument and valid file extension
+            // Check for valid arguments: layout files, directories or response files (@file)
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                if (IsFileExtension(argv[i + 1], ".rgl"))
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
                 {
-                    strcpy(inFileName, argv[i + 1]);    // Read input filename
+                    AddCliJobInput(&batch, argv[i + 1], true);
+                    i++;
                 }
-                else LOG("WARNING: Input file extension not recognized\n");
-
-                i++;
             }
             else LOG("WARNING: No input file provided\n");
         }
+        else if (argv[i][0] == '@')
+        {
+            AddCliJobInput(&batch, argv[i], true);      // Response file with input files list
+        }
         else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
         {
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
                 if (IsFileExtension(argv[i + 1], ".c") ||
-                    IsFileExtension(argv[i + 1], ".h"))
+                    IsFileExtension(argv[i + 1], ".h") ||
+                    IsFileExtension(argv[i + 1], ".hpp") ||
+                    IsFileExtension(argv[i + 1], ".rgl"))
                 {
                     strcpy(outFileName, argv[i + 1]);   // Read output filename
                 }
@@ -3589,6 +3893,58 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: No output file provided\n");
         }
+        else if ((strcmp(argv[i], "-O") == 0) || (strcmp(argv[i], "--output-dir") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                strncpy(outputDir, argv[i + 1], 255);   // Read output directory
+                i++;
+            }
+            else LOG("WARNING: No output directory provided\n");
+        }
+        else if ((strcmp(argv[i], "-p") == 0) || (strcmp(argv[i], "--output-pattern") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (IsFileExtension(argv[i + 1], ".c") ||
+                    IsFileExtension(argv[i + 1], ".h") ||
+                    IsFileExtension(argv[i + 1], ".hpp") ||
+                    IsFileExtension(argv[i + 1], ".rgl"))
+                {
+                    if (strstr(argv[i + 1], "{name}") == NULL) LOG("WARNING: Output pattern does not contain {name}\n");
+                    strncpy(outputPattern, argv[i + 1], 255);     // Read output file name pattern
+                }
+                else LOG("WARNING: Output pattern extension not recognized\n");
+
+                i++;
+            }
+            else LOG("WARNING: No output pattern provided\n");
+        }
+        else if ((strcmp(argv[i], "-j") == 0) || (strcmp(argv[i], "--jobs") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                threadCount = atoi(argv[i + 1]);
+
+                if (threadCount < 1) threadCount = 1;
+                else if (threadCount > MAX_CLI_WORKER_THREADS) threadCount = MAX_CLI_WORKER_THREADS;
+
+                i++;
+            }
+            else LOG("WARNING: No jobs count provided\n");
+        }
+        else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--format") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (strcmp(argv[i + 1], "binary") == 0) outputBinary = true;
+                else if (strcmp(argv[i + 1], "text") == 0) outputBinary = false;
+                else LOG("WARNING: Layout format not recognized\n");
+
+                i++;
+            }
+            else LOG("WARNING: No layout format provided\n");
+        }
         else if ((strcmp(argv[i], "-t") == 0) || (strcmp(argv[i], "--template") == 0))
         {
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
@@ -3604,6 +3960,28 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: No template file provided\n");
         }
+        else if ((strcmp(argv[i], "-D") == 0) || (strcmp(argv[i], "--define") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                // Define user template variable: KEY=VALUE
+                const char *separator = strchr(argv[i + 1], '=');
+                int keyLength = (separator != NULL)? (int)(separator - argv[i + 1]) : 0;
+
+                if ((keyLength > 0) && (keyLength < 64))
+                {
+                    char key[64] = { 0 };
+                    strncpy(key, argv[i + 1], keyLength);
+
+                    if (!SetCodeVariable(key, separator + 1)) LOG("WARNING: Template variable can not be defined: %s\n", key);
+                    definesHash = ComputeDataHash(definesHash, argv[i + 1], (int)strlen(argv[i + 1]) + 1);
+                }
+                else LOG("WARNING: Template variable definition not valid, expected KEY=VALUE\n");
+
+                i++;
+            }
+            else LOG("WARNING: No template variable definition provided\n");
+        }
         else if ((strcmp(argv[i], "-n") == 0) || (strcmp(argv[i], "--name") == 0))
         {
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
@@ -3648,370 +4026,2530 @@ static void ProcessCommandLine(int argc, char *argv[])
         {
             cliNoComments = true;
         }
-    }
-
-    // Process input file
-    if (inFileName[0] != '\0')
-    {
-        // Set a default name for output in case not provided
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.c");
-
-        LOG("\nInput file:       %s", inFileName);
-        LOG("\nOutput file:      %s", outFileName);
-
-        // Support .rlg layout processing to generate .c
-        GuiLayout *layout = LoadLayout(inFileName);
+        else if ((strcmp(argv[i], "--cache-static") == 0))
+        {
+            cliCacheStatic = true;
+        }
+        else if ((strcmp(argv[i], "--table") == 0))
+        {
+            cliTable = true;
+        }
+        else if ((strcmp(argv[i], "--cpp") == 0))
+        {
+            cliConstexpr = true;
+        }
+        else if ((strcmp(argv[i], "-s") == 0) || (strcmp(argv[i], "--stamp") == 0))
+        {
+            useStamps = true;
+        }
+        else if ((strcmp(argv[i], "--depfile") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                strncpy(depFile, argv[i + 1], 511);     // Read dependencies file name
+                i++;
+            }
+            else LOG("WARNING: No dependencies file provided\n");
+        }
+    }
+
+    int failedCount = 0;
+
+    // Create output directory (including full path) if it does not exist
+    // NOTE: Input files are not processed if output directory can not be created
+    if ((batch.count > 0) && (outputDir[0] != '\0') && !DirectoryExists(outputDir) && (MakeDirectory(outputDir) != 0))
+    {
+        printf("ERROR: Output directory could not be created: %s\n", outputDir);
+        failedCount = batch.count;
+
+        RL_FREE(batch.jobs);
+        batch.count = 0;
+    }
+
+    // Process input files
+    if (batch.count > 0)
+    {
+        // Define output file names and layout names
+        // NOTE: Single input keeps output file name (-o) and default layout name,
+        // multiple inputs use output pattern and input file name as layout name
+        if ((batch.count == 1) && (outputDir[0] == '\0') && (outputPattern[0] == '\0'))
+        {
+            // Set a default name for output in case not provided
+            if (outFileName[0] == '\0') strcpy(outFileName, "output.c");
+
+            strcpy(batch.jobs[0].outFileName, outFileName);
+            snprintf(batch.jobs[0].name, sizeof(batch.jobs[0].name), "%s", cliName? cliName : "window_codegen");
+        }
+        else
+        {
+            if (outFileName[0] != '\0') LOG("WARNING: Output file ignored for multiple inputs, use --output-dir and --output-pattern\n");
+
+            // Default output pattern depends on template file extension
+            if (outputPattern[0] == '\0')
+            {
+                if (templateFile[0] != '\0') snprintf(outputPattern, 256, "{name}%s", GetFileExtension(templateFile));
+                else strcpy(outputPattern, cliConstexpr? "{name}.hpp" : (cliTable? "{name}.h" : "{name}.c"));
+            }
+
+            const char *patternName = strstr(outputPattern, "{name}");
+            const char *separator = (outputDir[0] != '\0')? "/" : "";
+
+            for (int i = 0; i < batch.count; i++)
+            {
+                CliJob *job = &batch.jobs[i];
+                char baseName[64] = { 0 };
+
+                snprintf(baseName, sizeof(baseName), "%s", GetFileNameWithoutExt(job->inFileName));
+
+                if (patternName != NULL) snprintf(job->outFileName, 512, "%s%s%.*s%s%s", outputDir, separator, (int)(patternName - outputPattern), outputPattern, baseName, patternName + 6);
+                else snprintf(job->outFileName, 512, "%s%s%s", outputDir, separator, outputPattern);
+
+                snprintf(job->name, sizeof(job->name), "%s", cliName? cliName : baseName);
+            }
+        }
+
+        // NOTE: Output type is checked before processing, file names functions are not thread-safe
+        for (int i = 0; i < batch.count; i++) batch.jobs[i].layoutOutput = IsFileExtension(batch.jobs[i].outFileName, ".rgl");
 
         GuiLayoutConfig guiConfig = { 0 };
         memset(&guiConfig, 0, sizeof(GuiLayoutConfig));
-        strcpy(guiConfig.name, cliName ? cliName : "window_codegen");
         strcpy(guiConfig.version, cliVersion ? cliVersion : toolVersion);
         strcpy(guiConfig.company, cliCompany ? cliCompany : "raylib technologies");
         strcpy(guiConfig.description, cliDescription ? cliDescription : "tool description");
         guiConfig.exportAnchors = !cliNoAnchors;
         guiConfig.defineRecs = cliRecs;
         guiConfig.fullComments = !cliNoComments;
+        guiConfig.cacheStaticControls = cliCacheStatic;
 
-        // Generate C code for gui layout->controls
+        // Load code template, compiled once for all jobs
         char *guiTemplateCustom = NULL;
         if (templateFile[0] != '\0') guiTemplateCustom = LoadFileText(templateFile);
 
-        char *toolstr = NULL;
-        if (guiTemplateCustom != NULL)
+        const char *templateText = guiTemplateStandardCode;
+        if (guiTemplateCustom != NULL) templateText = guiTemplateCustom;
+        else if (cliConstexpr) templateText = guiTemplateConstexpr;
+        else if (cliTable) templateText = guiTemplateTable;
+        GuiCodeTemplate codeTemplate = LoadCodeTemplate(templateText);
+
+        // Report template variables not recognized (no code generated for them)
+        for (int i = 0; (codeTemplate.unknownCount > 0) && (i < codeTemplate.tokenCount); i++)
         {
-            toolstr = GenLayoutCode(guiTemplateCustom, layout, (Vector2){ 0, 0 }, guiConfig);
-            RL_FREE(guiTemplateCustom);
+            GuiCodeToken token = codeTemplate.tokens[i];
+            if ((token.type == CODE_TOKEN_VARIABLE) && (token.variable < 0)) LOG("\nWARNING: Unknown template variable: $(%.*s)", token.length, codeTemplate.text + token.offset);
+        }
+
+        batch.codeTemplate = &codeTemplate;
+        batch.config = guiConfig;
+        batch.outputBinary = outputBinary;
+        batch.useStamps = useStamps;
+
+        // Compute inputs hash common to all jobs, layout data and name are added per job
+        // NOTE: Config fields are hashed one by one, struct padding is not hashed
+        // NOTE: Every GuiLayoutConfig flag affecting generated code must be hashed, so stamps are invalidated on change
+        unsigned char options[7] = { guiConfig.exportAnchors, guiConfig.defineRecs, guiConfig.defineTexts, guiConfig.fullComments,
+                                     guiConfig.exportButtonFunctions, guiConfig.cacheStaticControls, outputBinary };
+        batch.hash = ComputeDataHash(definesHash, TOOL_VERSION, (int)strlen(TOOL_VERSION) + 1);
+        batch.hash = ComputeDataHash(batch.hash, templateText, (int)strlen(templateText) + 1);
+        batch.hash = ComputeDataHash(batch.hash, guiConfig.version, (int)strlen(guiConfig.version) + 1);
+        batch.hash = ComputeDataHash(batch.hash, guiConfig.company, (int)strlen(guiConfig.company) + 1);
+        batch.hash = ComputeDataHash(batch.hash, guiConfig.description, (int)strlen(guiConfig.description) + 1);
+        batch.hash = ComputeDataHash(batch.hash, options, (int)sizeof(options));
+
+        ProcessCliJobs(&batch, threadCount);
+
+        // Report jobs results, in input order
+        for (int i = 0; i < batch.count; i++)
+        {
+            CliJob *job = &batch.jobs[i];
+
+            LOG("\nInput file:       %s", job->inFileName);
+            LOG("\nOutput file:      %s%s", job->outFileName, job->upToDate? " (up to date)" : "");
+
+            switch (job->result)
+            {
+                case CLI_JOB_ERROR_LOAD: printf("ERROR: %s: Layout file could not be loaded\n", job->inFileName); break;
+                case CLI_JOB_ERROR_WRITE: printf("ERROR: %s: Output file could not be written: %s\n", job->inFileName, job->outFileName); break;
+                default: break;
+            }
+
+            if (job->result != CLI_JOB_SUCCESS) failedCount++;
         }
-        else toolstr = GenLayoutCode(guiTemplateStandardCode, layout, (Vector2){ 0, 0 }, guiConfig);
 
-        FILE *ftool = fopen(outFileName, "wt");
-        fprintf(ftool, toolstr);    // Write code string to file
-        fclose(ftool);
+        LOG("\nProcessed files:  %i (%i failed)\n", batch.count, failedCount);
+
+        if (depFile[0] != '\0') SaveCliDepFile(&batch, depFile, templateFile);
 
-        UnloadLayout(layout);
-        RL_FREE(toolstr);
+        UnloadCodeTemplate(codeTemplate);
+        RL_FREE(guiTemplateCustom);
+        RL_FREE(batch.jobs);
     }
 
+    UnloadCodeVariables();
+
     if (showUsageInfo) ShowCommandLineInfo();
+
+    return (failedCount > 0)? 1 : 0;
 }
-#endif // PLATFORM_DESKTOP
 
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export data functions
-//--------------------------------------------------------------------------------------------
-// Load layout from text file
-// NOTE: If NULL provided, an empty layout is initialized
-static GuiLayout *LoadLayout(const char *fileName)
+// Add command line input: layout file (.rgl), directory (.rgl files) or response file (@file, one input per line)
+// NOTE: Response files entries could be layout files or directories
+static void AddCliJobInput(CliJobBatch *batch, const char *path, bool responseFile)
 {
-    GuiLayout *layout = (GuiLayout *)RL_CALLOC(1, sizeof(GuiLayout));
-
-    ResetLayout(layout);    // Init some default values
-
-    if (fileName != NULL)   // Try loading text layout file
+    if (responseFile && (path[0] == '@'))
     {
-        FILE *rglFile = fopen(fileName, "rt");
+        char *text = LoadFileText(path + 1);
 
-        if (rglFile != NULL)
+        if (text != NULL)
         {
-            char buffer[256] = { 0 };
-            char anchorName[MAX_ANCHOR_NAME_LENGTH] = { 0 };
+            char *line = text;
 
-            fgets(buffer, 256, rglFile);
-
-            while (!feof(rglFile))
+            while ((line != NULL) && (line[0] != '\0'))
             {
-                switch (buffer[0])
-                {
-                    case 'r':
-                    {
-                        sscanf(buffer, "r %f %f %f %f", &layout->refWindow.x, &layout->refWindow.y, &layout->refWindow.width, &layout->refWindow.height);
-
-                        // NOTE: Reference window defines anchor[0]
-                        layout->anchors[0].id = 0;
-                        layout->anchors[0].ap = NULL;
-                        layout->anchors[0].x = layout->refWindow.x;
-                        layout->anchors[0].y = layout->refWindow.y;
-                        layout->anchors[0].enabled = true;
-                        strcpy(layout->anchors[0].name, "refPoint");
-
-                        layout->anchorCount++;
-                    } break;
-                    case 'a':
-                    {
-                        int enabled = 0;
-                        sscanf(buffer, "a %d %s %d %d %d",
-                            &layout->anchors[layout->anchorCount].id,
-                            anchorName,
-                            &layout->anchors[layout->anchorCount].x,
-                            &layout->anchors[layout->anchorCount].y,
-                            &enabled);
-
-                        if (layout->anchors[layout->anchorCount].id > 0)
-                        {
-                            layout->anchors[layout->anchorCount].enabled = (enabled? true : false);
-                            strcpy(layout->anchors[layout->anchorCount].name, anchorName);
+                char *next = strchr(line, '\n');
+                if (next != NULL) *next++ = '\0';
 
-                            layout->anchorCount++;
-                        }
-                    } break;
-                    case 'c':
-                    {
-                        int anchorId = 0;
-                        sscanf(buffer, "c %d %d %s %f %f %f %f %d %[^\n]s",
-                            &layout->controls[layout->controlCount].id,
-                            &layout->controls[layout->controlCount].type,
-                            layout->controls[layout->controlCount].name,
-                            &layout->controls[layout->controlCount].rec.x,
-                            &layout->controls[layout->controlCount].rec.y,
-                            &layout->controls[layout->controlCount].rec.width,
-                            &layout->controls[layout->controlCount].rec.height,
-                            &anchorId,
-                            layout->controls[layout->controlCount].text);
-
-                        layout->controls[layout->controlCount].ap = &layout->anchors[anchorId];
-
-                        // NOTE: refWindow offset (anchor[0]) must be added to controls with no anchor
-                        if (anchorId == 0)
-                        {
-                            layout->controls[layout->controlCount].rec.x += layout->refWindow.x;
-                            layout->controls[layout->controlCount].rec.y += layout->refWindow.y;
-                        }
+                // Trim line spaces and carriage return
+                while ((*line == ' ') || (*line == '\t')) line++;
+                int length = (int)strlen(line);
+                while ((length > 0) && ((line[length - 1] == ' ') || (line[length - 1] == '\t') || (line[length - 1] == '\r'))) line[--length] = '\0';
 
-                        layout->controlCount++;
-                    } break;
-                    default: break;
-                }
+                if ((length > 0) && (line[0] != '#')) AddCliJobInput(batch, line, false);
 
-                fgets(buffer, 256, rglFile);
+                line = next;
             }
 
-            fclose(rglFile);
+            UnloadFileText(text);
+        }
+        else printf("ERROR: Response file could not be loaded: %s\n", path + 1);
+    }
+    else if (DirectoryExists(path))
+    {
+        FilePathList files = LoadDirectoryFilesEx(path, ".rgl", false);
+
+        for (unsigned int i = 0; i < files.count; i++) AddCliJobInput(batch, files.paths[i], false);
 
-            // NOTE: refWindow offset (anchor[0]) must be added to all anchors
-            for (int i = 1; i < layout->anchorCount; i++)
+        UnloadDirectoryFiles(files);
+    }
+    else if (IsFileExtension(path, ".rgl"))
+    {
+        if (strlen(path) < 512)
+        {
+            if (batch->count >= batch->capacity)
             {
-                layout->anchors[i].x += layout->refWindow.x;
-                layout->anchors[i].y += layout->refWindow.y;
+                batch->capacity = (batch->capacity > 0)? batch->capacity*2 : 16;
+                batch->jobs = (CliJob *)RL_REALLOC(batch->jobs, batch->capacity*sizeof(CliJob));
             }
+
+            CliJob *job = &batch->jobs[batch->count];
+            memset(job, 0, sizeof(CliJob));
+            strcpy(job->inFileName, path);
+
+            batch->count++;
         }
+        else LOG("WARNING: Input file name too long\n");
     }
-    else
+    else LOG("WARNING: Input file extension not recognized\n");
+}
+
+// Command line worker thread, jobs are picked until all jobs are processed
+#if defined(_WIN32)
+static unsigned long __stdcall CliJobsWorker(void *data)
+#else
+static void *CliJobsWorker(void *data)
+#endif
+{
+    CliJobBatch *batch = (CliJobBatch *)data;
+
+    for (int index = (int)ATOMIC_FETCH_ADD(&batch->nextJob, 1); index < batch->count; index = (int)ATOMIC_FETCH_ADD(&batch->nextJob, 1))
     {
-        // Define reference anchor
-        layout->anchors[0].x = 0;
-        layout->anchors[0].y = 40;
-        layout->anchors[0].enabled = true;
-        layout->refWindow.x = 0;
-        layout->refWindow.y = 40;
-        layout->anchorCount = 1;
+        ProcessCliJob(batch, &batch->jobs[index]);
     }
 
-    return layout;
+    return 0;
 }
 
-// Unload layout
-static void UnloadLayout(GuiLayout *layout)
+// Process command line jobs, distributed on worker threads
+// NOTE: Calling thread also processes jobs, if a thread can not be created its jobs are processed by running workers
+static void ProcessCliJobs(CliJobBatch *batch, int threadCount)
 {
-    RL_FREE(layout);
-}
+    if (threadCount > batch->count) threadCount = batch->count;
 
-// Reset layout to default values
-static void ResetLayout(GuiLayout *layout)
-{
-    // Set anchor points to default values
-    for (int i = 0; i < MAX_ANCHOR_POINTS; i++)
-    {
-        layout->anchors[i].id = i;
-        layout->anchors[i].x = 0;
-        layout->anchors[i].y = 0;
-        layout->anchors[i].enabled = false;
-        layout->anchors[i].hidding = false;
-        memset(layout->anchors[i].name, 0, MAX_ANCHOR_NAME_LENGTH);
+#if defined(_WIN32)
+    void *threads[MAX_CLI_WORKER_THREADS] = { 0 };
+#else
+    pthread_t threads[MAX_CLI_WORKER_THREADS] = { 0 };
+#endif
+    bool threadsActive[MAX_CLI_WORKER_THREADS] = { 0 };
 
-        if (i == 0) strcpy(layout->anchors[i].name, "refPoint");
-        else strcpy(layout->anchors[i].name, TextFormat("anchor%02i", i));
-    }
+    batch->nextJob = 0;
 
-    // Initialize layout controls data
-    for (int i = 0; i < MAX_GUI_CONTROLS; i++)
+    for (int i = 1; i < threadCount; i++)
     {
-        layout->controls[i].id = 0;
-        layout->controls[i].type = 0;
-        layout->controls[i].rec = (Rectangle){ 0, 0, 0, 0 };
-        memset(layout->controls[i].text, 0, MAX_CONTROL_TEXT_LENGTH);
-        memset(layout->controls[i].name, 0, MAX_CONTROL_NAME_LENGTH);
-        layout->controls[i].ap = &layout->anchors[0];  // By default, set parent anchor
+#if defined(_WIN32)
+        threads[i] = CreateThread(NULL, 0, CliJobsWorker, batch, 0, NULL);
+        threadsActive[i] = (threads[i] != NULL);
+#else
+        threadsActive[i] = (pthread_create(&threads[i], NULL, CliJobsWorker, batch) == 0);
+#endif
     }
 
-    layout->refWindow = (Rectangle){ 0, 40, -1, -1 };
-    layout->anchorCount = 0;
-    layout->controlCount = 0;
+    CliJobsWorker(batch);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (threadsActive[i])
+        {
+#if defined(_WIN32)
+            WaitForSingleObject(threads[i], 0xffffffff);    // INFINITE
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+    }
 }
 
-// Save layout information as text file
-static void SaveLayout(GuiLayout *layout, const char *fileName)
+// Process command line job: load layout, generate code (or convert layout format) and write output
+// NOTE: Only thread-safe functions are used, job results are reported once all jobs are processed
+static void ProcessCliJob(CliJobBatch *batch, CliJob *job)
 {
-    #define RGL_FILE_VERSION_TEXT "4.0"
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(job->inFileName, &dataSize);
 
-    FILE *rglFile = fopen(fileName, "wt");
+    if (fileData == NULL)
+    {
+        job->result = CLI_JOB_ERROR_LOAD;
+        return;
+    }
 
-    if (rglFile != NULL)
+    // Check inputs hash stamp, output is not generated if up to date
+    char stampFileName[520] = { 0 };
+    char stampText[32] = { 0 };
+
+    if (batch->useStamps)
     {
-        // Write some description comments
-        fprintf(rglFile, "#\n# rgl layout text file (v%s) - raygui layout file generated using rGuiLayout\n#\n", RGL_FILE_VERSION_TEXT);
-        fprintf(rglFile, "# Number of controls:     %i\n#\n", layout->controlCount);
-        fprintf(rglFile, "# Ref. window:    r <x> <y> <width> <height>\n");
-        fprintf(rglFile, "# Anchor info:    a <id> <name> <posx> <posy> <enabled>\n");
-        fprintf(rglFile, "# Control info:   c <id> <type> <name> <rectangle> <anchor_id> <text>\n#\n");
+        unsigned long long hash = ComputeDataHash(batch->hash, fileData, dataSize);
+        hash = ComputeDataHash(hash, job->name, (int)strlen(job->name) + 1);
 
-        // Write reference window and reference anchor (anchor[0])
-        fprintf(rglFile, "r %i %i %i %i\n", (int)layout->refWindow.x, (int)layout->refWindow.y, (int)layout->refWindow.width, (int)layout->refWindow.height);
-        //fprintf(rglFile, "a %03i %s %i %i %i\n", layout->anchors[0].id, layout->anchors[0].name, layout->anchors[0].x, layout->anchors[0].y, layout->anchors[0].enabled);
+        snprintf(stampFileName, 520, "%s.stamp", job->outFileName);
+        snprintf(stampText, 32, "%016llx\n", hash);
 
-        for (int i = 1; i < MAX_ANCHOR_POINTS; i++)
+        if (FileExists(job->outFileName) && IsFileTextEqual(stampFileName, stampText))
         {
-            if (layout->anchors[i].enabled)
-            {
-                fprintf(rglFile, "a %03i %s %i %i %i\n",
-                    layout->anchors[i].id,
-                    layout->anchors[i].name,
-                    (int)(layout->anchors[i].x - (int)layout->refWindow.x),
-                    (int)(layout->anchors[i].y - (int)layout->refWindow.y),
-                    layout->anchors[i].enabled);
-            }
+            job->upToDate = true;
+            UnloadFileData(fileData);
+            return;
         }
+    }
+
+    GuiLayout *layout = (GuiLayout *)RL_CALLOC(1, sizeof(GuiLayout));
+    ResetLayout(layout);
+    LoadLayoutData(layout, fileData, dataSize);
+    UnloadFileData(fileData);
 
-        for (int i = 0; i < layout->controlCount; i++)
+    // Support .rgl layout conversion between text and binary formats
+    if (job->layoutOutput)
+    {
+        // NOTE: Layout dirty flag is only cleared if layout file is saved
+        layout->dirty = true;
+        SaveLayout(layout, job->outFileName, batch->outputBinary);
+        if (layout->dirty) job->result = CLI_JOB_ERROR_WRITE;
+    }
+    else
+    {
+        GuiLayoutConfig config = batch->config;
+        strcpy(config.name, job->name);
+
+        // Generate C code for gui layout controls, streamed into a temporary file
+        // NOTE: Output file is only replaced if code is changed, file modification time is kept
+        char tempFileName[520] = { 0 };
+        snprintf(tempFileName, 520, "%s.tmp", job->outFileName);
+
+        FILE *tempFile = fopen(tempFileName, "wt");
+
+        if (tempFile != NULL)
         {
-            if (layout->controls[i].ap->id == 0)
+            bool success = GenLayoutCodeToSink(batch->codeTemplate, layout, (Vector2){ 0, 0 }, config, (GuiCodeSink){ WriteCodeSinkFile, tempFile });
+            if (fclose(tempFile) != 0) success = false;
+
+            if (!success)
             {
-                fprintf(rglFile, "c %03i %i %s %i %i %i %i %i %s\n",
-                    layout->controls[i].id,
-                    layout->controls[i].type,
-                    layout->controls[i].name,
-                    (int)layout->controls[i].rec.x - (int)layout->refWindow.x,
-                    (int)layout->controls[i].rec.y - (int)layout->refWindow.y,
-                    (int)layout->controls[i].rec.width,
-                    (int)layout->controls[i].rec.height,
-                    layout->controls[i].ap->id,
-                    layout->controls[i].text);
+                remove(tempFileName);
+                job->result = CLI_JOB_ERROR_WRITE;
+            }
+            else if (IsFileDataEqual(job->outFileName, tempFileName))
+            {
+                remove(tempFileName);
+                job->upToDate = true;
             }
             else
             {
-                fprintf(rglFile, "c %03i %i %s %i %i %i %i %i %s\n",
-                    layout->controls[i].id,
-                    layout->controls[i].type,
-                    layout->controls[i].name,
-                    (int)layout->controls[i].rec.x,
-                    (int)layout->controls[i].rec.y,
-                    (int)layout->controls[i].rec.width,
-                    (int)layout->controls[i].rec.height,
-                    layout->controls[i].ap->id,
-                    layout->controls[i].text);
+                remove(job->outFileName);
+                if (rename(tempFileName, job->outFileName) != 0) job->result = CLI_JOB_ERROR_WRITE;
             }
         }
+        else job->result = CLI_JOB_ERROR_WRITE;
+    }
+
+    UnloadLayout(layout);
 
-        fclose(rglFile);
+    // Save inputs hash stamp, only if output is valid
+    if (batch->useStamps && (job->result == CLI_JOB_SUCCESS) && !IsFileTextEqual(stampFileName, stampText))
+    {
+        FILE *stampFile = fopen(stampFileName, "wt");
+
+        if (stampFile != NULL)
+        {
+            fputs(stampText, stampFile);
+            fclose(stampFile);
+        }
     }
+}
 
-/*
-    if (binary)
+// Save dependencies file (Make/Ninja depfile), one rule per output: <output>: <input> [<template>]
+// NOTE: If file name contains {name}, one dependencies file is saved per output
+static void SaveCliDepFile(const CliJobBatch *batch, const char *fileName, const char *templateFile)
+{
+    const char *patternName = strstr(fileName, "{name}");
+    FILE *depFile = NULL;
+
+    for (int i = 0; i < batch->count; i++)
     {
-        #define RGL_FILE_VERSION_BINARY 400
+        const CliJob *job = &batch->jobs[i];
 
-        FILE *rglFile = fopen(fileName, "wb");
+        if (job->result != CLI_JOB_SUCCESS) continue;
 
-        if (rglFile != NULL)
+        if (patternName != NULL)
         {
-            // Layout File Structure (.rgl)
-            // ------------------------------------------------------
-            // Offset  | Size    | Type       | Description
-            // ------------------------------------------------------
-            // 0       | 4       | char       | Signature: "rGL "
-            // 4       | 2       | short      | Version: 200
-            // 6       | 2       | short      | reserved
-            //
-            // Ref window data
-            // 8       | 4       | int        | ref window x
-            // 12      | 4       | int        | ref window x
-            // 16      | 4       | int        | ref window width
-            // 20      | 4       | int        | ref window height
-            //
-            // Anchor info data:    a <id> <name> <posx> <posy> <enabled>\n");
-            // 24      | 4       | int        | Anchor count
-            // for (i = 1; i < anchorCount; i++)
-            // {
-            //    x    | 4       | int        | Anchor id
-            //    x    | 64      | char       | Anchor name
-            //    x    | 4       | int        | Anchor posX
-            //    x    | 4       | int        | Anchor posY
-            //    x    | 4       | int        | Anchor enabled?
-            // }
-            //
-            // Control info data:   c <id> <type> <name> <rectangle> <anchor_id> <text>\n#\n")
-            // x       | 4       | int        | Control count
-            // for (i = 0; i < countCount; i++)
-            // {
-            //    x    | 4       | int        | Control id
-            //    x    | 4       | int        | Control type
-            //    x    | 64      | char       | Control name
-            //    x    | 4       | int        | Control rec x
-            //    x    | 4       | int        | Control rec y
-            //    x    | 4       | int        | Control rec width
-            //    x    | 4       | int        | Control rec height
-            //    x    | 4       | int        | Control anchor id
-            //    x    | 128     | char       | Control text
-            // }
+            char depFileName[512] = { 0 };
+            char baseName[64] = { 0 };
 
-            char signature[5] = "rGL ";
-            short version = RGL_FILE_VERSION_BINARY;
-            short reserved = 0;
+            snprintf(baseName, sizeof(baseName), "%s", GetFileNameWithoutExt(job->inFileName));
+            snprintf(depFileName, 512, "%.*s%s%s", (int)(patternName - fileName), fileName, baseName, patternName + 6);
 
-            fwrite(signature, 1, 4, rglFile);
-            fwrite(&version, sizeof(short), 1, rglFile);
-            fwrite(&reserved, sizeof(short), 1, rglFile);
+            depFile = fopen(depFileName, "wt");
+        }
+        else if (depFile == NULL) depFile = fopen(fileName, "wt");
 
-            int rec[4] = { (int)layout->refWindow.x, (int)layout->refWindow.y, (int)layout->refWindow.width, (int)layout->refWindow.height };
-            fwrite(&rec[0], sizeof(int), 1, rglFile);
-            fwrite(&rec[1], sizeof(int), 1, rglFile);
-            fwrite(&rec[2], sizeof(int), 1, rglFile);
-            fwrite(&rec[3], sizeof(int), 1, rglFile);
+        if (depFile == NULL)
+        {
+            printf("ERROR: Dependencies file could not be written: %s\n", fileName);
+            return;
+        }
 
-            fwrite(&layout->anchorCount, sizeof(int), 1, rglFile);
+        // Write rule, paths spaces are escaped (make and ninja syntax)
+        const char *paths[3] = { job->outFileName, job->inFileName, templateFile };
+        int pathCount = (templateFile[0] != '\0')? 3 : 2;
 
-            // WARNING: anchor[0] is already implicit in ref window
-            for (int i = 1, x = 0, y = 0, e = 0; i < anchorCount; i++)
+        for (int p = 0; p < pathCount; p++)
+        {
+            for (const char *c = paths[p]; *c != '\0'; c++)
             {
-                fwrite(&layout->anchors[i].id, sizeof(int), 1, rglFile); // Anchor id
-                fwrite(&layout->anchors[i].name, sizeof(char), MAX_ANCHOR_NAME_LENGTH, rglFile); // Anchor name
-                x = (int)(layout->anchors[i].x - (int)layout->refWindow.x);
-                fwrite(&x, sizeof(int), 1, rglFile); // Anchor posX
-                y = (int)(layout->anchors[i].y - (int)layout->refWindow.y),
-                fwrite(&y, sizeof(int), 1, rglFile); // Anchor posY
-                e = (layout->anchors[i].enabled? 1 : 0);
-                fwrite(&e, sizeof(int), 1, rglFile); // Anchor enabled?
+                if ((*c == ' ') || (*c == '#')) fputc('\\', depFile);
+                else if (*c == '$') fputc('$', depFile);
+                fputc(*c, depFile);
             }
 
-            fwrite(&layout->controlCount, sizeof(int), 1, rglFile);
+            fputs((p == 0)? ":" : "", depFile);
+            fputs((p < (pathCount - 1))? " " : "\n", depFile);
+        }
+
+        if (patternName != NULL)
+        {
+            fclose(depFile);
+            depFile = NULL;
+        }
+    }
+
+    if (depFile != NULL) fclose(depFile);
+}
+
+// Check if file text is equal to provided text (no file means not equal)
+// NOTE: File is read in text mode, same as written, so line endings are translated
+static bool IsFileTextEqual(const char *fileName, const char *text)
+{
+    bool equal = false;
+    FILE *file = fopen(fileName, "rt");
+
+    if (file != NULL)
+    {
+        char buffer[4096] = { 0 };
+        const char *ptr = text;
+        size_t remaining = strlen(text);
+        size_t count = 0;
+
+        equal = true;
 
-            for (int i = 0; i < countCount; i++)
+        while (equal && ((count = fread(buffer, 1, sizeof(buffer), file)) > 0))
+        {
+            if ((count > remaining) || (memcmp(buffer, ptr, count) != 0)) equal = false;
+            else
             {
-                fwrite(&layout->controls[i].id, sizeof(int), 1, rglFile); // Control id
-                fwrite(&layout->controls[i].type, sizeof(int), 1, rglFile); // Control type
-                fwrite(&layout->controls[i].name, sizeof(char), MAX_CONTROL_NAME_LENGTH, rglFile); // Control name
-                rec = (Rectangle){ (int)layout->controls[i].rec.x, (int)layout->controls[i].rec.y, (int)layout->controls[i].rec.width, (int)layout->controls[i].rec.height };
-                fwrite(&rec[0], sizeof(int), 1, rglFile); // Control rec x
-                fwrite(&rec[1], sizeof(int), 1, rglFile); // Control rec y
-                fwrite(&rec[2], sizeof(int), 1, rglFile); // Control rec width
-                fwrite(&rec[3], sizeof(int), 1, rglFile); // Control rec height
-                fwrite(&layout->controls[i].ap->id, sizeof(int), 1, rglFile); // Control anchor id
-                fwrite(&layout->controls[i].text, sizeof(char), MAX_CONTROL_TEXT_LENGTH, rglFile); // Control text
+                ptr += count;
+                remaining -= count;
             }
-
-            fclose(rglFile);
         }
+
+        if (remaining > 0) equal = false;
+
+        fclose(file);
     }
-*/
+
+    return equal;
+}
+
+// Check if files data is equal (no file means not equal)
+// NOTE: Files are compared in chunks, files are not fully loaded
+static bool IsFileDataEqual(const char *fileName1, const char *fileName2)
+{
+    bool equal = false;
+    FILE *file1 = fopen(fileName1, "rb");
+    FILE *file2 = fopen(fileName2, "rb");
+
+    if ((file1 != NULL) && (file2 != NULL))
+    {
+        char buffer1[4096] = { 0 };
+        char buffer2[4096] = { 0 };
+        size_t count1 = 0;
+        size_t count2 = 0;
+
+        equal = true;
+
+        do
+        {
+            count1 = fread(buffer1, 1, sizeof(buffer1), file1);
+            count2 = fread(buffer2, 1, sizeof(buffer2), file2);
+
+            if ((count1 != count2) || (memcmp(buffer1, buffer2, count1) != 0)) equal = false;
+
+        } while (equal && (count1 > 0));
+    }
+
+    if (file1 != NULL) fclose(file1);
+    if (file2 != NULL) fclose(file2);
+
+    return equal;
+}
+#endif // PLATFORM_DESKTOP
+
+// Compute data hash (FNV-1a 64-bit), accumulated over previous hash
+static unsigned long long ComputeDataHash(unsigned long long hash, const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++) hash = (hash ^ bytes[i])*1099511628211ull;
+
+    return hash;
+}
+
+//--------------------------------------------------------------------------------------------
+// Load/Save/Export data functions
+//--------------------------------------------------------------------------------------------
+// Load layout from text file
+// NOTE: If NULL provided, an empty layout is initialized
+static GuiLayout *LoadLayout(const char *fileName)
+{
+    GuiLayout *layout = (GuiLayout *)RL_CALLOC(1, sizeof(GuiLayout));
+
+    ResetLayout(layout);    // Init some default values
+
+    if (fileName != NULL)   // Try loading layout file
+    {
+        // NOTE: Full file is loaded in a single read, binary or text format is detected by signature
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        if (fileData != NULL)
+        {
+            saveBinaryLayout = LoadLayoutData(layout, fileData, dataSize);
+            UnloadFileData(fileData);
+        }
+    }
+    else
+    {
+        // Define reference anchor
+        layout->anchors[0].x = 0;
+        layout->anchors[0].y = 40;
+        layout->anchors[0].enabled = true;
+        layout->refWindow.x = 0;
+        layout->refWindow.y = 40;
+        layout->anchorCount = 1;
+    }
+
+    return layout;
+}
+
+// Load layout data from file data, binary or text format is detected by signature
+// NOTE: No global state is modified, it can be called from multiple threads (on different layouts)
+static bool LoadLayoutData(GuiLayout *layout, const unsigned char *data, int size)
+{
+    bool binary = ((size >= 4) && (memcmp(data, "rGL ", 4) == 0));
+
+    if (binary) LoadLayoutBinaryData(layout, data, size);
+    else LoadLayoutTextData(layout, (const char *)data, size);
+
+    // NOTE: refWindow offset (anchor[0]) must be added to all anchors
+    for (int i = 1; i < layout->anchorCount; i++)
+    {
+        layout->anchors[i].x += layout->refWindow.x;
+        layout->anchors[i].y += layout->refWindow.y;
+    }
+
+    return binary;
+}
+
+// Load layout data from text file data
+// NOTE: Records are tokenized in place, fields are copied once into layout data,
+// no line length limit is imposed
+static void LoadLayoutTextData(GuiLayout *layout, const char *text, int size)
+{
+    const char *ptr = text;
+    const char *end = text + size;
+
+    while (ptr < end)
+    {
+        const char *line = ptr;
+
+        // Move ptr to next line start
+        while ((ptr < end) && (*ptr != '\n')) ptr++;
+        const char *lineEnd = ptr;
+        if (ptr < end) ptr++;
+
+        if (line == lineEnd) continue;
+
+        switch (line[0])
+        {
+            case 'r':
+            {
+                line = ScanFloat(line + 1, lineEnd, &layout->refWindow.x);
+                line = ScanFloat(line, lineEnd, &layout->refWindow.y);
+                line = ScanFloat(line, lineEnd, &layout->refWindow.width);
+                line = ScanFloat(line, lineEnd, &layout->refWindow.height);
+
+                // NOTE: Reference window defines anchor[0]
+                layout->anchors[0].id = 0;
+                layout->anchors[0].x = layout->refWindow.x;
+                layout->anchors[0].y = layout->refWindow.y;
+                layout->anchors[0].enabled = true;
+                strcpy(layout->anchors[0].name, "refPoint");
+
+                layout->anchorCount++;
+            } break;
+            case 'a':
+            {
+                ReserveLayoutAnchors(layout, layout->anchorCount + 1);
+
+                GuiAnchorPoint *anchor = &layout->anchors[layout->anchorCount];
+                const char *name = NULL;
+                int nameLength = 0;
+                int enabled = 0;
+
+                line = ScanInt(line + 1, lineEnd, &anchor->id);
+
+                if (anchor->id > 0)
+                {
+                    line = ScanWord(line, lineEnd, &name, &nameLength);
+                    if (nameLength > (MAX_ANCHOR_NAME_LENGTH - 1)) nameLength = MAX_ANCHOR_NAME_LENGTH - 1;
+                    memcpy(anchor->name, name, nameLength);
+                    anchor->name[nameLength] = '\0';
+
+                    line = ScanInt(line, lineEnd, &anchor->x);
+                    line = ScanInt(line, lineEnd, &anchor->y);
+                    line = ScanInt(line, lineEnd, &enabled);
+
+                    anchor->enabled = (enabled? true : false);
+
+                    layout->anchorCount++;
+                }
+            } break;
+            case 'c':
+            {
+                ReserveLayoutControls(layout, layout->controlCount + 1);
+
+                GuiLayoutControl *control = &layout->controls[layout->controlCount];
+                GuiLayoutControlInfo *info = &layout->controlsInfo[layout->controlCount];
+                const char *name = NULL;
+                const char *text = NULL;
+                int nameLength = 0;
+                int textLength = 0;
+                int anchorId = 0;
+
+                line = ScanInt(line + 1, lineEnd, &info->id);
+                line = ScanInt(line, lineEnd, &control->type);
+                line = ScanWord(line, lineEnd, &name, &nameLength);
+                line = ScanFloat(line, lineEnd, &control->rec.x);
+                line = ScanFloat(line, lineEnd, &control->rec.y);
+                line = ScanFloat(line, lineEnd, &control->rec.width);
+                line = ScanFloat(line, lineEnd, &control->rec.height);
+                line = ScanInt(line, lineEnd, &anchorId);
+                line = ScanText(line, lineEnd, &text, &textLength);
+
+                // NOTE: Name and text are copied once, directly into layout strings pool
+                if (nameLength > (MAX_CONTROL_NAME_LENGTH - 1)) nameLength = MAX_CONTROL_NAME_LENGTH - 1;
+                if (textLength > (MAX_CONTROL_TEXT_LENGTH - 1)) textLength = MAX_CONTROL_TEXT_LENGTH - 1;
+                info->name = AddLayoutString(layout, name, nameLength);
+                info->text = AddLayoutString(layout, text, textLength);
+
+                if ((anchorId < 0) || (anchorId >= layout->anchorCapacity)) anchorId = 0;
+                control->anchorId = anchorId;
+
+                // NOTE: refWindow offset (anchor[0]) must be added to controls with no anchor
+                if (anchorId == 0)
+                {
+                    control->rec.x += layout->refWindow.x;
+                    control->rec.y += layout->refWindow.y;
+                }
+
+                layout->controlCount++;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Load layout data from binary file data
+// NOTE: Records are fixed size, fields are read directly, no parsing required
+static void LoadLayoutBinaryData(GuiLayout *layout, const unsigned char *data, int size)
+{
+    const unsigned char *ptr = data;
+    const unsigned char *end = data + size;
+
+    short version = 0;
+    int count = 0;
+    int value[4] = { 0 };
+
+    if (size < (8 + 4*4 + 4)) return;
+
+    memcpy(&version, ptr + 4, sizeof(short));
+    ptr += 8;   // Skip signature, version and reserved
+
+    if (version != RGL_FILE_VERSION_BINARY)
+    {
+        LOG("WARNING: Layout binary file version not supported\n");
+        return;
+    }
+
+    // Read reference window, it defines anchor[0]
+    memcpy(value, ptr, 4*sizeof(int));
+    ptr += 4*sizeof(int);
+
+    layout->refWindow = (Rectangle){ (float)value[0], (float)value[1], (float)value[2], (float)value[3] };
+    layout->anchors[0].id = 0;
+    layout->anchors[0].x = value[0];
+    layout->anchors[0].y = value[1];
+    layout->anchors[0].enabled = true;
+    strcpy(layout->anchors[0].name, "refPoint");
+    layout->anchorCount = 1;
+
+    // Read anchors data
+    memcpy(&count, ptr, sizeof(int));
+    ptr += sizeof(int);
+
+    if (count > (int)((end - ptr)/RGL_BINARY_ANCHOR_SIZE)) count = (int)((end - ptr)/RGL_BINARY_ANCHOR_SIZE);
+    if (count > 0) ReserveLayoutAnchors(layout, layout->anchorCount + count);
+
+    for (int i = 0; i < count; i++, ptr += RGL_BINARY_ANCHOR_SIZE)
+    {
+        GuiAnchorPoint *anchor = &layout->anchors[layout->anchorCount];
+
+        memcpy(value, ptr + 4 + RGL_BINARY_NAME_SIZE, 3*sizeof(int));
+        memcpy(&anchor->id, ptr, sizeof(int));
+        memcpy(anchor->name, ptr + 4, RGL_BINARY_NAME_SIZE);
+        anchor->name[RGL_BINARY_NAME_SIZE - 1] = '\0';
+        anchor->x = value[0];
+        anchor->y = value[1];
+        anchor->enabled = (value[2]? true : false);
+
+        layout->anchorCount++;
+    }
+
+    // Read controls data
+    if ((end - ptr) < (int)sizeof(int)) return;
+
+    memcpy(&count, ptr, sizeof(int));
+    ptr += sizeof(int);
+
+    if (count > (int)((end - ptr)/RGL_BINARY_CONTROL_SIZE)) count = (int)((end - ptr)/RGL_BINARY_CONTROL_SIZE);
+    if (count > 0) ReserveLayoutControls(layout, layout->controlCount + count);
+
+    for (int i = 0; i < count; i++, ptr += RGL_BINARY_CONTROL_SIZE)
+    {
+        GuiLayoutControl *control = &layout->controls[layout->controlCount];
+        GuiLayoutControlInfo *info = &layout->controlsInfo[layout->controlCount];
+        int anchorId = 0;
+
+        const char *name = (const char *)ptr + 8;
+        const char *text = (const char *)ptr + 8 + RGL_BINARY_NAME_SIZE + 4*4 + 4;
+        int nameLength = 0;
+        int textLength = 0;
+
+        while ((nameLength < (RGL_BINARY_NAME_SIZE - 1)) && (nameLength < (MAX_CONTROL_NAME_LENGTH - 1)) && (name[nameLength] != '\0')) nameLength++;
+        while ((textLength < (RGL_BINARY_TEXT_SIZE - 1)) && (textLength < (MAX_CONTROL_TEXT_LENGTH - 1)) && (text[textLength] != '\0')) textLength++;
+
+        memcpy(&info->id, ptr, sizeof(int));
+        memcpy(&control->type, ptr + 4, sizeof(int));
+        memcpy(value, ptr + 8 + RGL_BINARY_NAME_SIZE, 4*sizeof(int));
+        memcpy(&anchorId, ptr + 8 + RGL_BINARY_NAME_SIZE + 4*4, sizeof(int));
+        info->name = AddLayoutString(layout, name, nameLength);
+        info->text = AddLayoutString(layout, text, textLength);
+
+        control->rec = (Rectangle){ (float)value[0], (float)value[1], (float)value[2], (float)value[3] };
+
+        if ((anchorId < 0) || (anchorId >= layout->anchorCapacity)) anchorId = 0;
+        control->anchorId = anchorId;
+
+        // NOTE: refWindow offset (anchor[0]) must be added to controls with no anchor
+        if (anchorId == 0)
+        {
+            control->rec.x += layout->refWindow.x;
+            control->rec.y += layout->refWindow.y;
+        }
+
+        layout->controlCount++;
+    }
+}
+
+// Unload layout
+static void UnloadLayout(GuiLayout *layout)
+{
+    if (layout != NULL)
+    {
+        RL_FREE(layout->controls);
+        RL_FREE(layout->controlsInfo);
+        RL_FREE(layout->anchors);
+        RL_FREE(layout->strings.data);
+        RL_FREE(layout->strings.table);
+        RL_FREE(layout);
+    }
+}
+
+// Reset layout to default values
+static void ResetLayout(GuiLayout *layout)
+{
+    // NOTE: Allocated storage is kept, only initial anchors capacity is reserved (if required)
+    ReserveLayoutAnchors(layout, ANCHOR_POINTS_INITIAL_CAPACITY);
+
+    // Set anchor points to default values
+    for (int i = 0; i < layout->anchorCapacity; i++)
+    {
+        layout->anchors[i].id = i;
+        layout->anchors[i].x = 0;
+        layout->anchors[i].y = 0;
+        layout->anchors[i].enabled = false;
+        layout->anchors[i].hidding = false;
+        memset(layout->anchors[i].name, 0, MAX_ANCHOR_NAME_LENGTH);
+
+        if (i == 0) strcpy(layout->anchors[i].name, "refPoint");
+        else snprintf(layout->anchors[i].name, MAX_ANCHOR_NAME_LENGTH, "anchor%02i", i);
+    }
+
+    // Initialize layout controls data
+    for (int i = 0; i < layout->controlCapacity; i++)
+    {
+        layout->controls[i].type = 0;
+        layout->controls[i].rec = (Rectangle){ 0, 0, 0, 0 };
+        layout->controls[i].anchorId = 0;  // By default, set parent anchor
+        layout->controlsInfo[i].id = 0;
+        layout->controlsInfo[i].name = (GuiLayoutString){ 0 };
+        layout->controlsInfo[i].text = (GuiLayoutString){ 0 };
+    }
+
+    // Reset strings pool, only empty string is kept
+    if (layout->strings.data == NULL) CompactLayoutStrings(layout, STRINGS_POOL_INITIAL_CAPACITY, STRINGS_TABLE_INITIAL_CAPACITY);
+    else
+    {
+        layout->strings.size = 1;
+        layout->strings.tableCount = 0;
+        memset(layout->strings.table, 0, layout->strings.tableCapacity*sizeof(int));
+    }
+
+    layout->refWindow = (Rectangle){ 0, 40, -1, -1 };
+    layout->anchorCount = 0;
+    layout->controlCount = 0;
+
+    // NOTE: Generation keeps increasing, all controls and anchors are considered changed
+    layout->generation++;
+    for (int i = 0; i < layout->anchorCapacity; i++) layout->anchors[i].generation = layout->generation;
+    for (int i = 0; i < layout->controlCapacity; i++) layout->controlsInfo[i].generation = layout->generation;
+    layout->dirty = false;
+}
+
+// Copy layout data
+// NOTE: Controls reference anchors by index, no relink required
+static void CopyLayout(GuiLayout *dst, const GuiLayout *src)
+{
+    ReserveLayoutAnchors(dst, src->anchorCapacity);
+    ReserveLayoutControls(dst, src->controlCount);
+
+    memcpy(dst->anchors, src->anchors, src->anchorCapacity*sizeof(GuiAnchorPoint));
+
+    // Reset destination anchors not available on source
+    for (int i = src->anchorCapacity; i < dst->anchorCapacity; i++)
+    {
+        memset(&dst->anchors[i], 0, sizeof(GuiAnchorPoint));
+        dst->anchors[i].id = i;
+        snprintf(dst->anchors[i].name, MAX_ANCHOR_NAME_LENGTH, "anchor%02i", i);
+    }
+
+    if (src->controlCount > 0)
+    {
+        memcpy(dst->controls, src->controls, src->controlCount*sizeof(GuiLayoutControl));
+        memcpy(dst->controlsInfo, src->controlsInfo, src->controlCount*sizeof(GuiLayoutControlInfo));
+    }
+
+    // Reset destination controls not available on source
+    for (int i = src->controlCount; i < dst->controlCapacity; i++)
+    {
+        memset(&dst->controls[i], 0, sizeof(GuiLayoutControl));
+        memset(&dst->controlsInfo[i], 0, sizeof(GuiLayoutControlInfo));
+    }
+
+    // Copy strings pool, strings offsets are kept
+    if (src->strings.data != NULL)
+    {
+        if (dst->strings.capacity < src->strings.capacity)
+        {
+            dst->strings.data = (char *)RL_REALLOC(dst->strings.data, src->strings.capacity);
+            dst->strings.capacity = src->strings.capacity;
+        }
+
+        if (dst->strings.tableCapacity != src->strings.tableCapacity)
+        {
+            dst->strings.table = (int *)RL_REALLOC(dst->strings.table, src->strings.tableCapacity*sizeof(int));
+            dst->strings.tableCapacity = src->strings.tableCapacity;
+        }
+
+        memcpy(dst->strings.data, src->strings.data, src->strings.size);
+        memcpy(dst->strings.table, src->strings.table, src->strings.tableCapacity*sizeof(int));
+        dst->strings.size = src->strings.size;
+        dst->strings.tableCount = src->strings.tableCount;
+    }
+
+    dst->controlCount = src->controlCount;
+    dst->anchorCount = src->anchorCount;
+    dst->refWindow = src->refWindow;
+
+    // NOTE: Destination generation keeps increasing, all controls and anchors are considered changed
+    dst->generation = ((dst->generation > src->generation)? dst->generation : src->generation) + 1;
+    for (int i = 0; i < dst->anchorCapacity; i++) dst->anchors[i].generation = dst->generation;
+    for (int i = 0; i < dst->controlCapacity; i++) dst->controlsInfo[i].generation = dst->generation;
+    dst->dirty = src->dirty;
+}
+
+// Reserve layout controls capacity, storage grows if required
+// NOTE: New controls are initialized to default values
+static void ReserveLayoutControls(GuiLayout *layout, int capacity)
+{
+    if (capacity > layout->controlCapacity)
+    {
+        int newCapacity = (layout->controlCapacity > 0)? layout->controlCapacity : GUI_CONTROLS_INITIAL_CAPACITY;
+        while (newCapacity < capacity) newCapacity *= 2;
+
+        layout->controls = (GuiLayoutControl *)RL_REALLOC(layout->controls, newCapacity*sizeof(GuiLayoutControl));
+        layout->controlsInfo = (GuiLayoutControlInfo *)RL_REALLOC(layout->controlsInfo, newCapacity*sizeof(GuiLayoutControlInfo));
+
+        for (int i = layout->controlCapacity; i < newCapacity; i++)
+        {
+            memset(&layout->controls[i], 0, sizeof(GuiLayoutControl));
+            memset(&layout->controlsInfo[i], 0, sizeof(GuiLayoutControlInfo));
+        }
+
+        layout->controlCapacity = newCapacity;
+    }
+}
+
+// Reserve layout anchors capacity, storage grows if required
+// NOTE: New anchors are initialized to default values, controls reference anchors by index (no relink required)
+static void ReserveLayoutAnchors(GuiLayout *layout, int capacity)
+{
+    if (capacity > layout->anchorCapacity)
+    {
+        int newCapacity = (layout->anchorCapacity > 0)? layout->anchorCapacity : ANCHOR_POINTS_INITIAL_CAPACITY;
+        while (newCapacity < capacity) newCapacity *= 2;
+
+        layout->anchors = (GuiAnchorPoint *)RL_REALLOC(layout->anchors, newCapacity*sizeof(GuiAnchorPoint));
+
+        for (int i = layout->anchorCapacity; i < newCapacity; i++)
+        {
+            memset(&layout->anchors[i], 0, sizeof(GuiAnchorPoint));
+            layout->anchors[i].id = i;
+
+            if (i == 0) strcpy(layout->anchors[i].name, "refPoint");
+            else snprintf(layout->anchors[i].name, MAX_ANCHOR_NAME_LENGTH, "anchor%02i", i);
+        }
+
+        layout->anchorCapacity = newCapacity;
+    }
+}
+
+// Delete layout control, next controls are moved one position
+// NOTE: Controls id are kept, last control position is reset to default values
+static void DeleteLayoutControl(GuiLayout *layout, int index)
+{
+    for (int i = index; i < layout->controlCount; i++) MarkLayoutControlChanged(layout, i);
+
+    for (int i = index; i < (layout->controlCount - 1); i++)
+    {
+        layout->controls[i].type = layout->controls[i + 1].type;
+        layout->controls[i].rec = layout->controls[i + 1].rec;
+        layout->controlsInfo[i].text = layout->controlsInfo[i + 1].text;
+        layout->controlsInfo[i].name = layout->controlsInfo[i + 1].name;
+        layout->controls[i].anchorId = layout->controls[i + 1].anchorId;
+    }
+
+    layout->controlCount--;
+
+    GuiLayoutControl *control = &layout->controls[layout->controlCount];
+    control->type = 0;
+    control->rec = (Rectangle){ 0, 0, 0, 0 };
+    control->anchorId = 0;
+    layout->controlsInfo[layout->controlCount].text = (GuiLayoutString){ 0 };
+    layout->controlsInfo[layout->controlCount].name = (GuiLayoutString){ 0 };
+}
+
+// Insert layout control at provided position, next controls are moved one position
+// NOTE: Controls id are kept, inserted control must be initialized by caller
+static void InsertLayoutControl(GuiLayout *layout, int index)
+{
+    ReserveLayoutControls(layout, layout->controlCount + 1);
+
+    for (int i = layout->controlCount; i > index; i--)
+    {
+        layout->controls[i] = layout->controls[i - 1];
+        layout->controlsInfo[i].text = layout->controlsInfo[i - 1].text;
+        layout->controlsInfo[i].name = layout->controlsInfo[i - 1].name;
+    }
+
+    layout->controlsInfo[layout->controlCount].id = layout->controlCount;
+    layout->controlCount++;
+
+    for (int i = index; i < layout->controlCount; i++) MarkLayoutControlChanged(layout, i);
+}
+
+// Swap layout controls position (layer order)
+// NOTE: Controls id are kept
+static void SwapLayoutControls(GuiLayout *layout, int index1, int index2)
+{
+    GuiLayoutControl control = layout->controls[index1];
+    GuiLayoutControlInfo info = layout->controlsInfo[index1];
+
+    layout->controls[index1] = layout->controls[index2];
+    layout->controlsInfo[index1].name = layout->controlsInfo[index2].name;
+    layout->controlsInfo[index1].text = layout->controlsInfo[index2].text;
+
+    layout->controls[index2] = control;
+    layout->controlsInfo[index2].name = info.name;
+    layout->controlsInfo[index2].text = info.text;
+
+    MarkLayoutControlChanged(layout, index1);
+    MarkLayoutControlChanged(layout, index2);
+}
+
+// Mark layout as changed, layout generation is increased
+// NOTE: Changes can be checked comparing generations, no layout data comparison required
+static void MarkLayoutChanged(GuiLayout *layout)
+{
+    layout->generation++;
+    layout->dirty = true;
+}
+
+// Mark layout control as changed, control generation is updated to new layout generation
+static void MarkLayoutControlChanged(GuiLayout *layout, int index)
+{
+    MarkLayoutChanged(layout);
+    layout->controlsInfo[index].generation = layout->generation;
+}
+
+// Mark layout anchor as changed, anchor generation is updated to new layout generation
+static void MarkLayoutAnchorChanged(GuiLayout *layout, int index)
+{
+    MarkLayoutChanged(layout);
+    layout->anchors[index].generation = layout->generation;
+}
+
+// Add string to layout strings pool, returns string reference
+// NOTE: Strings are interned, if string is already in the pool it's reused
+static GuiLayoutString AddLayoutString(GuiLayout *layout, const char *text, int length)
+{
+    GuiLayoutString string = { 0 };     // Empty string by default
+    GuiLayoutStringPool *pool = &layout->strings;
+
+    if ((text == NULL) || (length <= 0)) return string;
+
+    // WARNING: Text could point to pool data, it must be copied before pool is compacted/reallocated
+    if ((pool->data != NULL) && (text >= pool->data) && (text < (pool->data + pool->capacity)))
+    {
+        char *textCopy = (char *)RL_MALLOC(length + 1);
+        memcpy(textCopy, text, length);
+        textCopy[length] = '\0';
+
+        string = AddLayoutString(layout, textCopy, length);
+
+        RL_FREE(textCopy);
+        return string;
+    }
+
+    // Make room for a new string, unused strings are removed first and storage grows if still required
+    if (((pool->size + length + 1) > pool->capacity) || ((pool->tableCount + 1)*2 > pool->tableCapacity))
+    {
+        int capacity = (pool->capacity > 0)? pool->capacity : STRINGS_POOL_INITIAL_CAPACITY;
+        int tableCapacity = (pool->tableCapacity > 0)? pool->tableCapacity : STRINGS_TABLE_INITIAL_CAPACITY;
+
+        CompactLayoutStrings(layout, capacity, tableCapacity);
+
+        if (((pool->size + length + 1) > capacity/2) || ((pool->tableCount + 1)*4 > tableCapacity))
+        {
+            while ((pool->size + length + 1) > capacity/2) capacity *= 2;
+            while ((pool->tableCount + 1)*4 > tableCapacity) tableCapacity *= 2;
+
+            CompactLayoutStrings(layout, capacity, tableCapacity);
+        }
+    }
+
+    // Look for string in intern table (FNV-1a hash, linear probing)
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < length; i++) hash = (hash ^ (unsigned char)text[i])*16777619u;
+
+    int index = (int)(hash & (unsigned int)(pool->tableCapacity - 1));
+
+    while (pool->table[index] != 0)
+    {
+        const char *poolText = pool->data + pool->table[index];
+
+        if ((strncmp(poolText, text, length) == 0) && (poolText[length] == '\0'))
+        {
+            string.offset = pool->table[index];
+            string.length = length;
+            return string;
+        }
+
+        index = (index + 1) & (pool->tableCapacity - 1);
+    }
+
+    // Add new string to pool
+    memcpy(pool->data + pool->size, text, length);
+    pool->data[pool->size + length] = '\0';
+    pool->table[index] = pool->size;
+    pool->tableCount++;
+
+    string.offset = pool->size;
+    string.length = length;
+    pool->size += (length + 1);
+
+    return string;
+}
+
+// Compact layout strings pool into new storage with provided capacity
+// NOTE: Only strings referenced by controls are kept, controls strings references are updated
+static void CompactLayoutStrings(GuiLayout *layout, int capacity, int tableCapacity)
+{
+    GuiLayoutStringPool prevPool = layout->strings;
+
+    layout->strings.data = (char *)RL_CALLOC(capacity, sizeof(char));
+    layout->strings.size = 1;           // Offset 0 is reserved for empty string
+    layout->strings.capacity = capacity;
+    layout->strings.table = (int *)RL_CALLOC(tableCapacity, sizeof(int));
+    layout->strings.tableCount = 0;
+    layout->strings.tableCapacity = tableCapacity;
+
+    // NOTE: All controls slots are checked, a control could be in creation process
+    for (int i = 0; i < layout->controlCapacity; i++)
+    {
+        GuiLayoutControlInfo *info = &layout->controlsInfo[i];
+
+        info->name = AddLayoutString(layout, prevPool.data + info->name.offset, info->name.length);
+        info->text = AddLayoutString(layout, prevPool.data + info->text.offset, info->text.length);
+    }
+
+    RL_FREE(prevPool.data);
+    RL_FREE(prevPool.table);
+}
+
+// Skip blank characters (space, tab, carriage return) up to line end
+static const char *ScanSkipBlanks(const char *ptr, const char *end)
+{
+    while ((ptr < end) && ((*ptr == ' ') || (*ptr == '\t') || (*ptr == '\r'))) ptr++;
+
+    return ptr;
+}
+
+// Scan integer value from line, returns position after scanned token
+// NOTE: On missing/invalid token value is left unchanged
+static const char *ScanInt(const char *ptr, const char *end, int *value)
+{
+    ptr = ScanSkipBlanks(ptr, end);
+
+    int sign = 1;
+    if ((ptr < end) && ((*ptr == '-') || (*ptr == '+'))) { if (*ptr == '-') sign = -1; ptr++; }
+
+    if ((ptr < end) && (*ptr >= '0') && (*ptr <= '9'))
+    {
+        int result = 0;
+        while ((ptr < end) && (*ptr >= '0') && (*ptr <= '9')) { result = result*10 + (*ptr - '0'); ptr++; }
+
+        *value = sign*result;
+    }
+
+    return ptr;
+}
+
+// Scan float value from line, returns position after scanned token
+// NOTE: Token is copied (bounded) and parsed with strtof(), same as sscanf("%f"),
+// on missing/invalid token value is left unchanged
+static const char *ScanFloat(const char *ptr, const char *end, float *value)
+{
+    ptr = ScanSkipBlanks(ptr, end);
+
+    char token[64] = { 0 };
+    int length = 0;
+    while ((ptr + length < end) && (length < 63) && (ptr[length] != ' ') && (ptr[length] != '\t') && (ptr[length] != '\r'))
+    {
+        token[length] = ptr[length];
+        length++;
+    }
+
+    char *tokenEnd = NULL;
+    float result = strtof(token, &tokenEnd);
+
+    if (tokenEnd != token)
+    {
+        *value = result;
+        ptr += (tokenEnd - token);
+    }
+
+    return ptr;
+}
+
+// Scan word (no blanks) from line, returns word position and length (not copied)
+static const char *ScanWord(const char *ptr, const char *end, const char **word, int *length)
+{
+    ptr = ScanSkipBlanks(ptr, end);
+
+    *word = ptr;
+    while ((ptr < end) && (*ptr != ' ') && (*ptr != '\t') && (*ptr != '\r')) ptr++;
+    *length = (int)(ptr - *word);
+
+    return ptr;
+}
+
+// Scan remaining line text (blanks included), returns text position and length (not copied)
+static const char *ScanText(const char *ptr, const char *end, const char **text, int *length)
+{
+    ptr = ScanSkipBlanks(ptr, end);
+
+    // Trim trailing carriage return (CRLF line endings)
+    const char *textEnd = end;
+    while ((textEnd > ptr) && (*(textEnd - 1) == '\r')) textEnd--;
+
+    *text = ptr;
+    *length = (int)(textEnd - ptr);
+
+    return end;
+}
+
+// Save layout information as text or binary file
+static void SaveLayout(GuiLayout *layout, const char *fileName, bool binary)
+{
+    if (binary)
+    {
+        FILE *rglFile = fopen(fileName, "wb");
+
+        if (rglFile != NULL)
+        {
+            // Layout File Structure (.rgl)
+            // ------------------------------------------------------
+            // Offset  | Size    | Type       | Description
+            // ------------------------------------------------------
+            // 0       | 4       | char       | Signature: "rGL "
+            // 4       | 2       | short      | Version: 400
+            // 6       | 2       | short      | reserved
+            //
+            // Ref window data
+            // 8       | 4       | int        | ref window x
+            // 12      | 4       | int        | ref window y
+            // 16      | 4       | int        | ref window width
+            // 20      | 4       | int        | ref window height
+            //
+            // Anchor info data:    a <id> <name> <posx> <posy> <enabled>
+            // 24      | 4       | int        | Anchor count (anchor[0] not included, defined by ref window)
+            // for (i = 0; i < anchorCount; i++)
+            // {
+            //    x    | 4       | int        | Anchor id
+            //    x    | 64      | char       | Anchor name
+            //    x    | 4       | int        | Anchor posX
+            //    x    | 4       | int        | Anchor posY
+            //    x    | 4       | int        | Anchor enabled?
+            // }
+            //
+            // Control info data:   c <id> <type> <name> <rectangle> <anchor_id> <text>
+            // x       | 4       | int        | Control count
+            // for (i = 0; i < controlCount; i++)
+            // {
+            //    x    | 4       | int        | Control id
+            //    x    | 4       | int        | Control type
+            //    x    | 64      | char       | Control name
+            //    x    | 4       | int        | Control rec x
+            //    x    | 4       | int        | Control rec y
+            //    x    | 4       | int        | Control rec width
+            //    x    | 4       | int        | Control rec height
+            //    x    | 4       | int        | Control anchor id
+            //    x    | 128     | char       | Control text
+            // }
+            //
+            // NOTE: Anchors positions and controls with no anchor (anchor[0]) are relative to ref window
+
+            char signature[5] = "rGL ";
+            short version = RGL_FILE_VERSION_BINARY;
+            short reserved = 0;
+
+            fwrite(signature, 1, 4, rglFile);
+            fwrite(&version, sizeof(short), 1, rglFile);
+            fwrite(&reserved, sizeof(short), 1, rglFile);
+
+            int rec[4] = { (int)layout->refWindow.x, (int)layout->refWindow.y, (int)layout->refWindow.width, (int)layout->refWindow.height };
+            fwrite(rec, sizeof(int), 4, rglFile);
+
+            // WARNING: anchor[0] is already implicit in ref window
+            int anchorCount = 0;
+            for (int i = 1; i < layout->anchorCapacity; i++) if (layout->anchors[i].enabled) anchorCount++;
+
+            fwrite(&anchorCount, sizeof(int), 1, rglFile);
+
+            for (int i = 1; i < layout->anchorCapacity; i++)
+            {
+                if (layout->anchors[i].enabled)
+                {
+                    unsigned char record[RGL_BINARY_ANCHOR_SIZE] = { 0 };
+                    int value[3] = {
+                        (int)(layout->anchors[i].x - (int)layout->refWindow.x),     // Anchor posX
+                        (int)(layout->anchors[i].y - (int)layout->refWindow.y),     // Anchor posY
+                        1                                                           // Anchor enabled?
+                    };
+
+                    memcpy(record, &layout->anchors[i].id, sizeof(int));            // Anchor id
+                    snprintf((char *)record + 4, RGL_BINARY_NAME_SIZE, "%s", layout->anchors[i].name);  // Anchor name
+                    memcpy(record + 4 + RGL_BINARY_NAME_SIZE, value, 3*sizeof(int));
+
+                    fwrite(record, 1, RGL_BINARY_ANCHOR_SIZE, rglFile);
+                }
+            }
+
+            fwrite(&layout->controlCount, sizeof(int), 1, rglFile);
+
+            for (int i = 0; i < layout->controlCount; i++)
+            {
+                unsigned char record[RGL_BINARY_CONTROL_SIZE] = { 0 };
+
+                rec[0] = (int)layout->controls[i].rec.x;
+                rec[1] = (int)layout->controls[i].rec.y;
+                rec[2] = (int)layout->controls[i].rec.width;
+                rec[3] = (int)layout->controls[i].rec.height;
+
+                if (layout->controls[i].anchorId == 0)
+                {
+                    rec[0] -= (int)layout->refWindow.x;
+                    rec[1] -= (int)layout->refWindow.y;
+                }
+
+                memcpy(record, &layout->controlsInfo[i].id, sizeof(int));               // Control id
+                memcpy(record + 4, &layout->controls[i].type, sizeof(int));         // Control type
+                snprintf((char *)record + 8, RGL_BINARY_NAME_SIZE, "%s", GetLayoutString(layout, layout->controlsInfo[i].name));   // Control name
+                memcpy(record + 8 + RGL_BINARY_NAME_SIZE, rec, 4*sizeof(int));      // Control rectangle
+                memcpy(record + 8 + RGL_BINARY_NAME_SIZE + 4*4, &layout->controls[i].anchorId, sizeof(int));   // Control anchor id
+                snprintf((char *)record + 8 + RGL_BINARY_NAME_SIZE + 4*4 + 4, RGL_BINARY_TEXT_SIZE, "%s", GetLayoutString(layout, layout->controlsInfo[i].text));    // Control text
+
+                fwrite(record, 1, RGL_BINARY_CONTROL_SIZE, rglFile);
+            }
+
+            fclose(rglFile);
+            layout->dirty = false;
+        }
+    }
+    else
+    {
+        FILE *rglFile = fopen(fileName, "wt");
+
+        if (rglFile != NULL)
+        {
+            // Write some description comments
+            fprintf(rglFile, "#\n# rgl layout text file (v%s) - raygui layout file generated using rGuiLayout\n#\n", RGL_FILE_VERSION_TEXT);
+            fprintf(rglFile, "# Number of controls:     %i\n#\n", layout->controlCount);
+            fprintf(rglFile, "# Ref. window:    r <x> <y> <width> <height>\n");
+            fprintf(rglFile, "# Anchor info:    a <id> <name> <posx> <posy> <enabled>\n");
+            fprintf(rglFile, "# Control info:   c <id> <type> <name> <rectangle> <anchor_id> <text>\n#\n");
+
+            // Write reference window and reference anchor (anchor[0])
+            fprintf(rglFile, "r %i %i %i %i\n", (int)layout->refWindow.x, (int)layout->refWindow.y, (int)layout->refWindow.width, (int)layout->refWindow.height);
+            //fprintf(rglFile, "a %03i %s %i %i %i\n", layout->anchors[0].id, layout->anchors[0].name, layout->anchors[0].x, layout->anchors[0].y, layout->anchors[0].enabled);
+
+            for (int i = 1; i < layout->anchorCapacity; i++)
+            {
+                if (layout->anchors[i].enabled)
+                {
+                    fprintf(rglFile, "a %03i %s %i %i %i\n",
+                        layout->anchors[i].id,
+                        layout->anchors[i].name,
+                        (int)(layout->anchors[i].x - (int)layout->refWindow.x),
+                        (int)(layout->anchors[i].y - (int)layout->refWindow.y),
+                        layout->anchors[i].enabled);
+                }
+            }
+
+            for (int i = 0; i < layout->controlCount; i++)
+            {
+                if (layout->controls[i].anchorId == 0)
+                {
+                    fprintf(rglFile, "c %03i %i %s %i %i %i %i %i %s\n",
+                        layout->controlsInfo[i].id,
+                        layout->controls[i].type,
+                        GetLayoutString(layout, layout->controlsInfo[i].name),
+                        (int)layout->controls[i].rec.x - (int)layout->refWindow.x,
+                        (int)layout->controls[i].rec.y - (int)layout->refWindow.y,
+                        (int)layout->controls[i].rec.width,
+                        (int)layout->controls[i].rec.height,
+                        layout->controls[i].anchorId,
+                        GetLayoutString(layout, layout->controlsInfo[i].text));
+                }
+                else
+                {
+                    fprintf(rglFile, "c %03i %i %s %i %i %i %i %i %s\n",
+                        layout->controlsInfo[i].id,
+                        layout->controls[i].type,
+                        GetLayoutString(layout, layout->controlsInfo[i].name),
+                        (int)layout->controls[i].rec.x,
+                        (int)layout->controls[i].rec.y,
+                        (int)layout->controls[i].rec.width,
+                        (int)layout->controls[i].rec.height,
+                        layout->controls[i].anchorId,
+                        GetLayoutString(layout, layout->controlsInfo[i].text));
+                }
+            }
+
+            fclose(rglFile);
+            layout->dirty = false;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------
+// Layout journal functions (undo/redo)
+//--------------------------------------------------------------------------------------------
+// Reset layout journal, history is cleared (storage is kept)
+// NOTE: Journal file is not changed, only memory history state
+static void ResetJournal(LayoutJournal *journal)
+{
+    journal->stepCount = 0;
+    journal->currentStep = 0;
+    journal->operationCount = 0;
+    journal->firstPendingOperation = 0;
+    journal->recording = false;
+
+    journal->firstStep = 0;
+    journal->historyCount = 0;
+    journal->savedStep = 0;
+    journal->windowOffset = JOURNAL_FILE_HEADER_SIZE;
+    journal->dataSize = JOURNAL_FILE_HEADER_SIZE;
+    journal->fileSize = JOURNAL_FILE_HEADER_SIZE;
+}
+
+// Unload layout journal
+static void UnloadJournal(LayoutJournal *journal)
+{
+    CloseJournal(journal);
+
+    RL_FREE(journal->steps);
+    RL_FREE(journal->operations);
+    RL_FREE(journal->controlOperation);
+
+    memset(journal, 0, sizeof(LayoutJournal));
+}
+
+// Open layout journal file for a layout file, returns true if previous session changes are recovered
+// NOTE: Journal file is only available while layout file is open, if it already exists
+// previous session was not closed properly, journal changes are replayed over loaded layout
+static bool OpenJournal(LayoutJournal *journal, GuiLayout *layout, const char *fileName)
+{
+    bool recovered = false;
+
+    CloseJournal(journal);
+    strcpy(journal->fileName, TextFormat("%s.journal", fileName));
+
+    journal->file = fopen(journal->fileName, "r+b");
+
+    if (journal->file != NULL)
+    {
+        char signature[5] = { 0 };
+        short version = 0;
+        short reserved = 0;
+        int header[4] = { 0 };      // History steps count, current step, saved step, steps data size
+        unsigned long long layoutHash = 0;
+
+        fread(signature, 1, 4, journal->file);
+        fread(&version, sizeof(short), 1, journal->file);
+        fread(&reserved, sizeof(short), 1, journal->file);
+        fread(header, sizeof(int), 4, journal->file);
+        fread(&layoutHash, sizeof(unsigned long long), 1, journal->file);
+
+        fseek(journal->file, 0, SEEK_END);
+        int fileSize = (int)ftell(journal->file);
+
+        // NOTE: Journal is only valid for the layout file data it was saved with,
+        // layout file could be changed externally (other tool, version control checkout)
+        bool valid = (TextIsEqual(signature, "rGLJ") && (version == JOURNAL_FILE_VERSION) &&
+                      (header[0] >= 0) && (header[1] >= 0) && (header[1] <= header[0]) && (header[2] >= 0) && (header[2] <= header[0]) &&
+                      (header[3] >= JOURNAL_FILE_HEADER_SIZE) && (header[3] <= fileSize) &&
+                      (layoutHash != 0) && (layoutHash == GetLayoutFileHash(fileName)));
+
+        // Find saved step record offset, layout file state
+        int offset = JOURNAL_FILE_HEADER_SIZE;
+
+        for (int i = 0; valid && (i < header[2]); i++)
+        {
+            int operationCount = -1;
+
+            fseek(journal->file, offset, SEEK_SET);
+            fread(&operationCount, sizeof(int), 1, journal->file);
+
+            if ((operationCount < 0) || (operationCount > (header[3] - offset)/(int)sizeof(JournalOperation))) valid = false;
+            else offset += JOURNAL_STEP_RECORD_SIZE(operationCount);
+
+            if (offset > header[3]) valid = false;
+        }
+
+        if (valid)
+        {
+            journal->firstStep = header[2];
+            journal->historyCount = header[0];
+            journal->savedStep = header[2];
+            journal->windowOffset = offset;
+            journal->dataSize = header[3];
+            journal->fileSize = fileSize;
+            journal->layoutHash = layoutHash;
+
+            // Replay journal steps from saved step to current step
+            while (((journal->firstStep + journal->currentStep) < header[1]) && RedoJournalStep(journal, layout)) { }
+            while (((journal->firstStep + journal->currentStep) > header[1]) && UndoJournalStep(journal, layout)) { }
+
+            recovered = (header[1] != header[2]);
+
+            // Journal steps could not be replayed (invalid data), replayed steps are kept but history is discarded
+            if ((journal->firstStep + journal->currentStep) != header[1]) valid = false;
+        }
+
+        if (!valid)
+        {
+            fclose(journal->file);
+            journal->file = NULL;
+            ResetJournal(journal);
+        }
+    }
+
+    // Create a new journal file if not available
+    if (journal->file == NULL)
+    {
+        journal->layoutHash = GetLayoutFileHash(fileName);
+        journal->file = fopen(journal->fileName, "w+b");
+        if (journal->file != NULL) WriteJournalHeader(journal);
+    }
+
+    return recovered;
+}
+
+// Close layout journal file, history is cleared
+// NOTE: Journal file is removed, layout file was closed properly
+static void CloseJournal(LayoutJournal *journal)
+{
+    if (journal->file != NULL)
+    {
+        fclose(journal->file);
+        remove(journal->fileName);
+        journal->file = NULL;
+    }
+
+    ResetJournal(journal);
+}
+
+// Save layout journal for a saved layout file, current step is set as saved step
+// NOTE: Journal file is compacted (discarded steps data removed) and moved next to layout file if required
+static void SaveJournal(LayoutJournal *journal, const GuiLayout *layout, const char *fileName)
+{
+    CommitJournalStep(journal, layout);
+
+    journal->savedStep = journal->firstStep + journal->currentStep;
+    journal->layoutHash = GetLayoutFileHash(fileName);
+
+    char journalFileName[512 + 16] = { 0 };
+    strcpy(journalFileName, TextFormat("%s.journal", fileName));
+
+    if ((journal->file != NULL) && (journal->fileSize == journal->dataSize) && TextIsEqual(journalFileName, journal->fileName))
+    {
+        WriteJournalHeader(journal);
+        return;
+    }
+
+    // Write a compacted journal file with current history
+    FILE *file = fopen(TextFormat("%s.tmp", journalFileName), "w+b");
+
+    if (file != NULL)
+    {
+        FILE *prevFile = journal->file;
+        journal->file = file;
+
+        if (prevFile != NULL)
+        {
+            // History steps data copied from current journal file (steps offsets are kept)
+            unsigned char buffer[4096] = { 0 };
+            int size = journal->dataSize - JOURNAL_FILE_HEADER_SIZE;
+
+            fseek(prevFile, JOURNAL_FILE_HEADER_SIZE, SEEK_SET);
+            fseek(file, JOURNAL_FILE_HEADER_SIZE, SEEK_SET);
+
+            while (size > 0)
+            {
+                int count = (int)fread(buffer, 1, (size < 4096)? size : 4096, prevFile);
+                if (count <= 0) break;
+
+                fwrite(buffer, 1, count, file);
+                size -= count;
+            }
+
+            fclose(prevFile);
+            remove(journal->fileName);
+        }
+        else
+        {
+            // NOTE: Without journal file all history steps are available in memory
+            int offset = JOURNAL_FILE_HEADER_SIZE;
+
+            for (int i = 0; i < journal->stepCount; i++)
+            {
+                journal->steps[i].offset = offset;
+                WriteJournalStep(journal, &journal->steps[i]);
+                offset += journal->steps[i].size;
+            }
+
+            journal->windowOffset = JOURNAL_FILE_HEADER_SIZE;
+            journal->dataSize = offset;
+        }
+
+        journal->fileSize = journal->dataSize;
+        WriteJournalHeader(journal);
+        fclose(file);
+
+        // Replace journal file
+        remove(journalFileName);
+        rename(TextFormat("%s.tmp", journalFileName), journalFileName);
+
+        strcpy(journal->fileName, journalFileName);
+        journal->file = fopen(journal->fileName, "r+b");
+
+        TrimJournalSteps(journal);
+    }
+}
+
+// Record layout change (reference window, anchors count), starts a new step if required
+// NOTE: Step changes are recorded until step is committed, redo steps are kept until then
+static void RecordLayoutChange(LayoutJournal *journal, GuiLayout *layout)
+{
+    if (!journal->recording)
+    {
+        journal->step.firstOperation = journal->operationCount;
+        journal->step.operationCount = 0;
+        journal->step.refWindow[0] = layout->refWindow;
+        journal->step.anchorCount[0] = layout->anchorCount;
+
+        journal->firstPendingOperation = journal->operationCount;
+        journal->recording = true;
+    }
+
+    MarkLayoutChanged(layout);
+}
+
+// Record control change (position, size, anchor, text, name), control state before change is stored
+// NOTE: Control state after change is stored when step is committed, only first change is recorded
+static void RecordControlChange(LayoutJournal *journal, GuiLayout *layout, int index)
+{
+    RecordLayoutChange(journal, layout);
+    MarkLayoutControlChanged(layout, index);
+
+    if (index >= journal->controlOperationCapacity)
+    {
+        int capacity = (layout->controlCapacity > index)? layout->controlCapacity : (index + 1);
+
+        journal->controlOperation = (int *)RL_REALLOC(journal->controlOperation, capacity*sizeof(int));
+        memset(journal->controlOperation + journal->controlOperationCapacity, 0, (capacity - journal->controlOperationCapacity)*sizeof(int));
+        journal->controlOperationCapacity = capacity;
+    }
+
+    // Check if control change is already recorded in current step (and pending)
+    int opIndex = journal->controlOperation[index] - 1;
+
+    if ((opIndex >= journal->firstPendingOperation) && (opIndex < journal->operationCount) &&
+        (journal->operations[opIndex].type == JOURNAL_CONTROL_CHANGE) && (journal->operations[opIndex].index == index)) return;
+
+    JournalOperation *operation = AddJournalOperation(journal, JOURNAL_CONTROL_CHANGE, index);
+    GetJournalControlState(layout, index, &operation->control[0]);
+
+    journal->controlOperation[index] = journal->operationCount;
+}
+
+// Record control creation, control must be already added to layout at provided index
+static void RecordControlCreate(LayoutJournal *journal, GuiLayout *layout, int index)
+{
+    RecordLayoutChange(journal, layout);
+    SealJournalOperations(journal, layout);
+
+    JournalOperation *operation = AddJournalOperation(journal, JOURNAL_CONTROL_CREATE, index);
+    GetJournalControlState(layout, index, &operation->control[1]);
+    operation->sealed = true;
+
+    MarkLayoutControlChanged(layout, index);
+
+    journal->firstPendingOperation = journal->operationCount;
+}
+
+// Record control deletion, control must be still available in layout at provided index
+static void RecordControlDelete(LayoutJournal *journal, GuiLayout *layout, int index)
+{
+    RecordLayoutChange(journal, layout);
+    SealJournalOperations(journal, layout);
+
+    JournalOperation *operation = AddJournalOperation(journal, JOURNAL_CONTROL_DELETE, index);
+    GetJournalControlState(layout, index, &operation->control[0]);
+    operation->sealed = true;
+
+    journal->firstPendingOperation = journal->operationCount;
+}
+
+// Record controls reorder (layer order), controls at provided positions are swapped
+static void RecordControlReorder(LayoutJournal *journal, GuiLayout *layout, int index, int otherIndex)
+{
+    RecordLayoutChange(journal, layout);
+    SealJournalOperations(journal, layout);
+
+    JournalOperation *operation = AddJournalOperation(journal, JOURNAL_CONTROL_REORDER, index);
+    operation->otherIndex = otherIndex;
+    operation->sealed = true;
+
+    journal->firstPendingOperation = journal->operationCount;
+}
+
+// Record anchor change (position, enabled, hidding, name), anchor state before change is stored
+static void RecordAnchorChange(LayoutJournal *journal, GuiLayout *layout, int index)
+{
+    RecordLayoutChange(journal, layout);
+    MarkLayoutAnchorChanged(layout, index);
+
+    // Check if anchor change is already recorded in current step (and pending)
+    for (int i = journal->firstPendingOperation; i < journal->operationCount; i++)
+    {
+        if ((journal->operations[i].type == JOURNAL_ANCHOR_CHANGE) && (journal->operations[i].index == index)) return;
+    }
+
+    JournalOperation *operation = AddJournalOperation(journal, JOURNAL_ANCHOR_CHANGE, index);
+    operation->anchor[0] = layout->anchors[index];
+}
+
+// Commit recorded step, returns true if a new undo step is added
+// NOTE: Unchanged controls/anchors are discarded, redo steps are removed if step is added
+static bool CommitJournalStep(LayoutJournal *journal, const GuiLayout *layout)
+{
+    if (!journal->recording) return false;
+
+    SealJournalOperations(journal, layout);
+
+    journal->step.refWindow[1] = layout->refWindow;
+    journal->step.anchorCount[1] = layout->anchorCount;
+    journal->recording = false;
+
+    // Remove operations with no changes
+    int count = 0;
+    for (int i = journal->step.firstOperation; i < journal->operationCount; i++)
+    {
+        JournalOperation *operation = &journal->operations[i];
+
+        if ((operation->type == JOURNAL_CONTROL_CHANGE) && (memcmp(&operation->control[0], &operation->control[1], sizeof(JournalControlState)) == 0)) continue;
+        if ((operation->type == JOURNAL_ANCHOR_CHANGE) &&
+            (operation->anchor[0].x == operation->anchor[1].x) && (operation->anchor[0].y == operation->anchor[1].y) &&
+            (operation->anchor[0].enabled == operation->anchor[1].enabled) && (operation->anchor[0].hidding == operation->anchor[1].hidding) &&
+            TextIsEqual(operation->anchor[0].name, operation->anchor[1].name)) continue;
+
+        if (i != (journal->step.firstOperation + count)) journal->operations[journal->step.firstOperation + count] = *operation;
+        count++;
+    }
+
+    journal->operationCount = journal->step.firstOperation + count;
+
+    if ((count == 0) && (journal->step.anchorCount[0] == journal->step.anchorCount[1]) &&
+        (memcmp(&journal->step.refWindow[0], &journal->step.refWindow[1], sizeof(Rectangle)) == 0))
+    {
+        // Nothing changed, step is discarded
+        journal->operationCount = journal->step.firstOperation;
+        return false;
+    }
+
+    // Remove redo steps, step operations are moved after current step operations
+    int firstOperation = (journal->currentStep > 0)? (journal->steps[journal->currentStep - 1].firstOperation + journal->steps[journal->currentStep - 1].operationCount) : 0;
+
+    if (firstOperation != journal->step.firstOperation)
+    {
+        memmove(journal->operations + firstOperation, journal->operations + journal->step.firstOperation, count*sizeof(JournalOperation));
+        journal->step.firstOperation = firstOperation;
+        journal->operationCount = firstOperation + count;
+    }
+
+    journal->step.operationCount = count;
+    journal->step.offset = (journal->currentStep > 0)? (journal->steps[journal->currentStep - 1].offset + journal->steps[journal->currentStep - 1].size) : journal->windowOffset;
+    journal->step.size = JOURNAL_STEP_RECORD_SIZE(count);
+
+    ReserveJournalStorage(journal, journal->currentStep + 1, 0);
+
+    journal->steps[journal->currentStep] = journal->step;
+    journal->currentStep++;
+    journal->stepCount = journal->currentStep;
+    journal->historyCount = journal->firstStep + journal->stepCount;
+    journal->firstPendingOperation = journal->operationCount;
+
+    // Saved layout state is not available in history anymore
+    if (journal->savedStep >= journal->historyCount) journal->savedStep = -1;
+
+    // Append step to journal file, discarded redo steps data is overwritten
+    if (journal->file != NULL)
+    {
+        WriteJournalStep(journal, &journal->step);
+
+        journal->dataSize = journal->step.offset + journal->step.size;
+        if (journal->dataSize > journal->fileSize) journal->fileSize = journal->dataSize;
+
+        WriteJournalHeader(journal);
+        TrimJournalSteps(journal);
+    }
+
+    return true;
+}
+
+// Undo last step, layout state before step is recovered
+static bool UndoJournalStep(LayoutJournal *journal, GuiLayout *layout)
+{
+    CommitJournalStep(journal, layout);
+
+    // Load previous step from journal file if not available in memory
+    if ((journal->currentStep == 0) && (journal->firstStep > 0) && (journal->file != NULL))
+    {
+        int size = 0;
+
+        fseek(journal->file, journal->windowOffset - (int)sizeof(int), SEEK_SET);
+        fread(&size, sizeof(int), 1, journal->file);
+
+        if ((size > 0) && LoadJournalStep(journal, journal->windowOffset - size, true))
+        {
+            journal->windowOffset -= size;
+            journal->firstStep--;
+            journal->currentStep++;
+        }
+    }
+
+    if (journal->currentStep <= 0) return false;
+
+    JournalStep *step = &journal->steps[journal->currentStep - 1];
+    if (!IsJournalStepValid(journal, step, layout, true)) return false;
+
+    journal->currentStep--;
+    ReserveLayoutAnchors(layout, step->anchorCount[0]);
+
+    // Apply inverse operations in reverse order
+    for (int i = step->firstOperation + step->operationCount - 1; i >= step->firstOperation; i--)
+    {
+        JournalOperation *operation = &journal->operations[i];
+
+        switch (operation->type)
+        {
+            case JOURNAL_CONTROL_CHANGE: SetJournalControlState(layout, operation->index, &operation->control[0]); break;
+            case JOURNAL_CONTROL_CREATE: DeleteLayoutControl(layout, operation->index); break;
+            case JOURNAL_CONTROL_DELETE:
+            {
+                InsertLayoutControl(layout, operation->index);
+                SetJournalControlState(layout, operation->index, &operation->control[0]);
+            } break;
+            case JOURNAL_CONTROL_REORDER: SwapLayoutControls(layout, operation->index, operation->otherIndex); break;
+            case JOURNAL_ANCHOR_CHANGE:
+            {
+                ReserveLayoutAnchors(layout, operation->index + 1);
+                layout->anchors[operation->index] = operation->anchor[0];
+                MarkLayoutAnchorChanged(layout, operation->index);
+            } break;
+            default: break;
+        }
+    }
+
+    layout->refWindow = step->refWindow[0];
+    layout->anchorCount = step->anchorCount[0];
+    MarkLayoutChanged(layout);
+
+    if (journal->file != NULL)
+    {
+        WriteJournalHeader(journal);
+        TrimJournalSteps(journal);
+    }
+
+    return true;
+}
+
+// Redo next step, layout state after step is recovered
+static bool RedoJournalStep(LayoutJournal *journal, GuiLayout *layout)
+{
+    CommitJournalStep(journal, layout);
+
+    // Load next step from journal file if not available in memory
+    if ((journal->currentStep == journal->stepCount) && ((journal->firstStep + journal->stepCount) < journal->historyCount) && (journal->file != NULL))
+    {
+        int offset = (journal->stepCount > 0)? (journal->steps[journal->stepCount - 1].offset + journal->steps[journal->stepCount - 1].size) : journal->windowOffset;
+
+        LoadJournalStep(journal, offset, false);
+    }
+
+    if (journal->currentStep >= journal->stepCount) return false;
+
+    JournalStep *step = &journal->steps[journal->currentStep];
+    if (!IsJournalStepValid(journal, step, layout, false)) return false;
+
+    journal->currentStep++;
+    ReserveLayoutAnchors(layout, step->anchorCount[1]);
+
+    // Apply operations in order
+    for (int i = step->firstOperation; i < (step->firstOperation + step->operationCount); i++)
+    {
+        JournalOperation *operation = &journal->operations[i];
+
+        switch (operation->type)
+        {
+            case JOURNAL_CONTROL_CHANGE: SetJournalControlState(layout, operation->index, &operation->control[1]); break;
+            case JOURNAL_CONTROL_CREATE:
+            {
+                InsertLayoutControl(layout, operation->index);
+                SetJournalControlState(layout, operation->index, &operation->control[1]);
+            } break;
+            case JOURNAL_CONTROL_DELETE: DeleteLayoutControl(layout, operation->index); break;
+            case JOURNAL_CONTROL_REORDER: SwapLayoutControls(layout, operation->index, operation->otherIndex); break;
+            case JOURNAL_ANCHOR_CHANGE:
+            {
+                ReserveLayoutAnchors(layout, operation->index + 1);
+                layout->anchors[operation->index] = operation->anchor[1];
+                MarkLayoutAnchorChanged(layout, operation->index);
+            } break;
+            default: break;
+        }
+    }
+
+    layout->refWindow = step->refWindow[1];
+    layout->anchorCount = step->anchorCount[1];
+    MarkLayoutChanged(layout);
+
+    if (journal->file != NULL)
+    {
+        WriteJournalHeader(journal);
+        TrimJournalSteps(journal);
+    }
+
+    return true;
+}
+
+// Add operation to journal, storage grows if required
+static JournalOperation *AddJournalOperation(LayoutJournal *journal, int type, int index)
+{
+    ReserveJournalStorage(journal, 0, journal->operationCount + 1);
+
+    JournalOperation *operation = &journal->operations[journal->operationCount];
+    memset(operation, 0, sizeof(JournalOperation));
+    operation->type = type;
+    operation->index = index;
+
+    journal->operationCount++;
+
+    return operation;
+}
+
+// Seal pending operations, state after change is stored
+// NOTE: Required before controls are moved to a different position (create, delete, reorder)
+static void SealJournalOperations(LayoutJournal *journal, const GuiLayout *layout)
+{
+    for (int i = journal->firstPendingOperation; i < journal->operationCount; i++)
+    {
+        JournalOperation *operation = &journal->operations[i];
+
+        if (!operation->sealed)
+        {
+            if (operation->type == JOURNAL_CONTROL_CHANGE) GetJournalControlState(layout, operation->index, &operation->control[1]);
+            else if (operation->type == JOURNAL_ANCHOR_CHANGE) operation->anchor[1] = layout->anchors[operation->index];
+
+            operation->sealed = true;
+        }
+    }
+
+    journal->firstPendingOperation = journal->operationCount;
+}
+
+// Reserve journal steps and operations capacity, storage grows if required
+static void ReserveJournalStorage(LayoutJournal *journal, int stepCapacity, int operationCapacity)
+{
+    if (stepCapacity > journal->stepCapacity)
+    {
+        int newCapacity = (journal->stepCapacity > 0)? journal->stepCapacity : JOURNAL_STEPS_INITIAL_CAPACITY;
+        while (newCapacity < stepCapacity) newCapacity *= 2;
+
+        journal->steps = (JournalStep *)RL_REALLOC(journal->steps, newCapacity*sizeof(JournalStep));
+        journal->stepCapacity = newCapacity;
+    }
+
+    if (operationCapacity > journal->operationCapacity)
+    {
+        int newCapacity = (journal->operationCapacity > 0)? journal->operationCapacity : JOURNAL_OPERATIONS_INITIAL_CAPACITY;
+        while (newCapacity < operationCapacity) newCapacity *= 2;
+
+        journal->operations = (JournalOperation *)RL_REALLOC(journal->operations, newCapacity*sizeof(JournalOperation));
+        journal->operationCapacity = newCapacity;
+    }
+}
+
+// Write journal file header, history state is updated
+// NOTE: Journal file is flushed, file is always valid for recovery
+static void WriteJournalHeader(LayoutJournal *journal)
+{
+    // Journal File Structure (.rgl.journal)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGLJ"
+    // 4       | 2       | short      | Version: 101
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | History steps count
+    // 12      | 4       | int        | Current step (steps applied)
+    // 16      | 4       | int        | Saved step (layout file state)
+    // 20      | 4       | int        | Steps data size (including header)
+    // 24      | 8       | uint64     | Saved layout file data hash (FNV-1a 64-bit)
+    //
+    // Step record (repeated, history order)
+    // foreach (step)
+    // {
+    //   0     | 4       | int        | Operations count
+    //   4     | 32      | Rectangle  | Reference window, before and after step
+    //   36    | 8       | int        | Anchors count, before and after step
+    //   44    | n       | JournalOperation | Step operations
+    //   44+n  | 4       | int        | Step record size (to read previous step)
+    // }
+    // NOTE: Journal file is intended for session recovery, operations data is not portable
+    char signature[4] = "rGLJ";
+    short version = JOURNAL_FILE_VERSION;
+    short reserved = 0;
+    int header[4] = { journal->historyCount, journal->firstStep + journal->currentStep, journal->savedStep, journal->dataSize };
+
+    fseek(journal->file, 0, SEEK_SET);
+    fwrite(signature, 1, 4, journal->file);
+    fwrite(&version, sizeof(short), 1, journal->file);
+    fwrite(&reserved, sizeof(short), 1, journal->file);
+    fwrite(header, sizeof(int), 4, journal->file);
+    fwrite(&journal->layoutHash, sizeof(unsigned long long), 1, journal->file);
+    fflush(journal->file);
+}
+
+// Write journal step record into journal file, at step offset
+static void WriteJournalStep(LayoutJournal *journal, const JournalStep *step)
+{
+    fseek(journal->file, step->offset, SEEK_SET);
+    fwrite(&step->operationCount, sizeof(int), 1, journal->file);
+    fwrite(step->refWindow, sizeof(Rectangle), 2, journal->file);
+    fwrite(step->anchorCount, sizeof(int), 2, journal->file);
+    fwrite(journal->operations + step->firstOperation, sizeof(JournalOperation), step->operationCount, journal->file);
+    fwrite(&step->size, sizeof(int), 1, journal->file);
+}
+
+// Load journal step record from journal file into memory steps, added before first or after last step
+static bool LoadJournalStep(LayoutJournal *journal, int offset, bool first)
+{
+    JournalStep step = { 0 };
+
+    // NOTE: Step record must be fully contained in journal valid data
+    if ((offset < JOURNAL_FILE_HEADER_SIZE) || (offset >= journal->dataSize)) return false;
+
+    fseek(journal->file, offset, SEEK_SET);
+    if ((fread(&step.operationCount, sizeof(int), 1, journal->file) != 1) || (step.operationCount < 0) ||
+        (step.operationCount > (journal->dataSize - offset)/(int)sizeof(JournalOperation))) return false;
+    if (fread(step.refWindow, sizeof(Rectangle), 2, journal->file) != 2) return false;
+    if (fread(step.anchorCount, sizeof(int), 2, journal->file) != 2) return false;
+
+    step.offset = offset;
+    step.size = JOURNAL_STEP_RECORD_SIZE(step.operationCount);
+
+    if ((offset + step.size) > journal->dataSize) return false;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if ((step.anchorCount[i] < 0) || (step.anchorCount[i] > JOURNAL_MAX_ANCHORS)) return false;
+    }
+
+    ReserveJournalStorage(journal, journal->stepCount + 1, journal->operationCount + step.operationCount);
+
+    if (first)
+    {
+        // Make room for step at the beginning of memory steps
+        memmove(journal->operations + step.operationCount, journal->operations, journal->operationCount*sizeof(JournalOperation));
+        memmove(journal->steps + 1, journal->steps, journal->stepCount*sizeof(JournalStep));
+        for (int i = 1; i <= journal->stepCount; i++) journal->steps[i].firstOperation += step.operationCount;
+
+        step.firstOperation = 0;
+        journal->steps[0] = step;
+    }
+    else
+    {
+        step.firstOperation = journal->operationCount;
+        journal->steps[journal->stepCount] = step;
+    }
+
+    // Check loaded operations, step is not added if any operation is not valid
+    bool valid = ((int)fread(journal->operations + step.firstOperation, sizeof(JournalOperation), step.operationCount, journal->file) == step.operationCount);
+
+    for (int i = 0; valid && (i < step.operationCount); i++) valid = IsJournalOperationValid(&journal->operations[step.firstOperation + i]);
+
+    if (!valid)
+    {
+        if (first)
+        {
+            memmove(journal->operations, journal->operations + step.operationCount, journal->operationCount*sizeof(JournalOperation));
+            memmove(journal->steps, journal->steps + 1, journal->stepCount*sizeof(JournalStep));
+            for (int i = 0; i < journal->stepCount; i++) journal->steps[i].firstOperation -= step.operationCount;
+        }
+
+        return false;
+    }
+
+    journal->stepCount++;
+    journal->operationCount += step.operationCount;
+    journal->firstPendingOperation = journal->operationCount;
+
+    return true;
+}
+
+// Trim memory steps to memory window, removed steps are available in journal file
+// NOTE: Older steps are removed first, only if current step is not close to them
+static void TrimJournalSteps(LayoutJournal *journal)
+{
+    if (journal->file == NULL) return;
+
+    while ((journal->stepCount > JOURNAL_MEMORY_STEPS) && (journal->currentStep > JOURNAL_MEMORY_STEPS/2))
+    {
+        int count = journal->steps[0].operationCount;
+
+        memmove(journal->operations, journal->operations + count, (journal->operationCount - count)*sizeof(JournalOperation));
+        memmove(journal->steps, journal->steps + 1, (journal->stepCount - 1)*sizeof(JournalStep));
+        for (int i = 0; i < (journal->stepCount - 1); i++) journal->steps[i].firstOperation -= count;
+
+        journal->windowOffset += JOURNAL_STEP_RECORD_SIZE(count);
+        journal->operationCount -= count;
+        journal->stepCount--;
+        journal->currentStep--;
+        journal->firstStep++;
+    }
+
+    while (journal->stepCount > JOURNAL_MEMORY_STEPS)
+    {
+        journal->operationCount -= journal->steps[journal->stepCount - 1].operationCount;
+        journal->stepCount--;
+    }
+
+    journal->firstPendingOperation = journal->operationCount;
+}
+
+// Get control state from layout (strings copied)
+static void GetJournalControlState(const GuiLayout *layout, int index, JournalControlState *state)
+{
+    memset(state, 0, sizeof(JournalControlState));
+
+    state->control = layout->controls[index];
+    state->id = layout->controlsInfo[index].id;
+    strncpy(state->name, GetLayoutString(layout, layout->controlsInfo[index].name), MAX_CONTROL_NAME_LENGTH - 1);
+    strncpy(state->text, GetLayoutString(layout, layout->controlsInfo[index].text), MAX_CONTROL_TEXT_LENGTH - 1);
+}
+
+// Set control state into layout (strings added to layout strings pool)
+static void SetJournalControlState(GuiLayout *layout, int index, const JournalControlState *state)
+{
+    ReserveLayoutAnchors(layout, state->control.anchorId + 1);
+
+    layout->controls[index] = state->control;
+    layout->controlsInfo[index].id = state->id;
+    layout->controlsInfo[index].name = AddLayoutString(layout, state->name, (int)strlen(state->name));
+    layout->controlsInfo[index].text = AddLayoutString(layout, state->text, (int)strlen(state->text));
+
+    MarkLayoutControlChanged(layout, index);
+}
+
+// Check journal operation loaded from file, indices are checked against limits (layout independent)
+// NOTE: Journal file data is not trusted, strings are terminated
+static bool IsJournalOperationValid(JournalOperation *operation)
+{
+    if ((operation->type < JOURNAL_CONTROL_CHANGE) || (operation->type > JOURNAL_ANCHOR_CHANGE)) return false;
+    if ((operation->index < 0) || (operation->otherIndex < 0)) return false;
+
+    if (operation->type == JOURNAL_ANCHOR_CHANGE)
+    {
+        if (operation->index >= JOURNAL_MAX_ANCHORS) return false;
+
+        for (int i = 0; i < 2; i++) operation->anchor[i].name[MAX_ANCHOR_NAME_LENGTH - 1] = '\0';
+    }
+    else
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            JournalControlState *state = &operation->control[i];
+
+            if ((state->control.type < 0) || (state->control.type > GUI_DUMMYREC)) return false;
+            if ((state->control.anchorId < 0) || (state->control.anchorId >= JOURNAL_MAX_ANCHORS)) return false;
+
+            state->name[MAX_CONTROL_NAME_LENGTH - 1] = '\0';
+            state->text[MAX_CONTROL_TEXT_LENGTH - 1] = '\0';
+        }
+    }
+
+    return true;
+}
+
+// Check journal step can be applied to layout, undo (reverse order) or redo
+// NOTE: Controls indices are checked against layout controls count, updated by create/delete operations
+static bool IsJournalStepValid(const LayoutJournal *journal, const JournalStep *step, const GuiLayout *layout, bool undo)
+{
+    int controlCount = layout->controlCount;
+
+    for (int k = 0; k < step->operationCount; k++)
+    {
+        const JournalOperation *operation = &journal->operations[undo? (step->firstOperation + step->operationCount - 1 - k) : (step->firstOperation + k)];
+        int index = operation->index;
+        bool valid = false;
+
+        switch (operation->type)
+        {
+            case JOURNAL_CONTROL_CHANGE: valid = ((index >= 0) && (index < controlCount)); break;
+            case JOURNAL_CONTROL_CREATE:
+            case JOURNAL_CONTROL_DELETE:
+            {
+                // Control is inserted on create redo and delete undo, removed otherwise
+                if ((operation->type == JOURNAL_CONTROL_CREATE) != undo)
+                {
+                    valid = ((index >= 0) && (index <= controlCount));
+                    controlCount++;
+                }
+                else
+                {
+                    valid = ((index >= 0) && (index < controlCount));
+                    controlCount--;
+                }
+            } break;
+            case JOURNAL_CONTROL_REORDER: valid = ((index >= 0) && (index < controlCount) && (operation->otherIndex >= 0) && (operation->otherIndex < controlCount)); break;
+            case JOURNAL_ANCHOR_CHANGE: valid = ((index >= 0) && (index < JOURNAL_MAX_ANCHORS)); break;
+            default: break;
+        }
+
+        if (!valid) return false;
+    }
+
+    return true;
+}
+
+// Get layout file data hash, journal is only valid for the layout file data it was saved with
+// NOTE: Returns 0 if file is not available
+static unsigned long long GetLayoutFileHash(const char *fileName)
+{
+    unsigned long long hash = 0;
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        hash = ComputeDataHash(14695981039346656037ull, fileData, dataSize);   // FNV-1a offset basis
+        UnloadFileData(fileData);
+    }
+
+    return hash;
+}
+
+//--------------------------------------------------------------------------------------------
+// Layout spatial index functions (controls focus)
+//--------------------------------------------------------------------------------------------
+// Sync layout spatial index with layout, only changed controls are updated
+// NOTE: Controls are changed if control or control anchor generation changed since indexed
+static void SyncSpatialIndex(LayoutSpatialIndex *index, const GuiLayout *layout)
+{
+    int textSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+    if ((index->generation == layout->generation) && (index->textSize == textSize) && (index->entryCount == layout->controlCount)) return;
+
+    // Groupbox focus rectangle depends on style text size, all controls updated
+    if (index->textSize != textSize)
+    {
+        for (int i = 0; i < index->entryCount; i++) RemoveSpatialIndexControl(index, i);
+        index->textSize = textSize;
+    }
+
+    // Remove entries not available anymore
+    for (int i = layout->controlCount; i < index->entryCount; i++) RemoveSpatialIndexControl(index, i);
+
+    if (layout->controlCount > index->entryCapacity)
+    {
+        int newCapacity = (index->entryCapacity > 0)? index->entryCapacity : GUI_CONTROLS_INITIAL_CAPACITY;
+        while (newCapacity < layout->controlCount) newCapacity *= 2;
+
+        index->entries = (SpatialIndexEntry *)RL_REALLOC(index->entries, newCapacity*sizeof(SpatialIndexEntry));
+        memset(index->entries + index->entryCapacity, 0, (newCapacity - index->entryCapacity)*sizeof(SpatialIndexEntry));
+        index->entryCapacity = newCapacity;
+    }
+
+    index->entryCount = layout->controlCount;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        SpatialIndexEntry *entry = &index->entries[i];
+        const GuiAnchorPoint *anchor = &layout->anchors[layout->controls[i].anchorId];
+
+        if (!entry->indexed || (entry->generation != layout->controlsInfo[i].generation) || (entry->anchorGeneration != anchor->generation))
+        {
+            RemoveSpatialIndexControl(index, i);
+
+            // Control focus rectangle, anchor offset applied
+            Rectangle rec = layout->controls[i].rec;
+            if (layout->controls[i].type == GUI_WINDOWBOX) rec.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT;  // Defined inside raygui.h
+            else if (layout->controls[i].type == GUI_GROUPBOX)
+            {
+                rec.y -= 10;
+                rec.height = textSize*2.0f;
+            }
+
+            if (layout->controls[i].anchorId > 0)
+            {
+                rec.x += anchor->x;
+                rec.y += anchor->y;
+            }
+
+            entry->rec = rec;
+            entry->cells[0] = (int)floorf(rec.x/SPATIAL_INDEX_CELL_SIZE);
+            entry->cells[1] = (int)floorf(rec.y/SPATIAL_INDEX_CELL_SIZE);
+            entry->cells[2] = (int)floorf((rec.x + rec.width)/SPATIAL_INDEX_CELL_SIZE);
+            entry->cells[3] = (int)floorf((rec.y + rec.height)/SPATIAL_INDEX_CELL_SIZE);
+            entry->generation = layout->controlsInfo[i].generation;
+            entry->anchorGeneration = anchor->generation;
+
+            AddSpatialIndexControl(index, i);
+        }
+    }
+
+    index->generation = layout->generation;
+}
+
+// Unload layout spatial index
+static void UnloadSpatialIndex(LayoutSpatialIndex *index)
+{
+    for (int i = 0; i < SPATIAL_INDEX_BUCKETS; i++) RL_FREE(index->buckets[i].controls);
+    RL_FREE(index->large.controls);
+    RL_FREE(index->entries);
+
+    memset(index, 0, sizeof(LayoutSpatialIndex));
+}
+
+// Get topmost control at point, controls linked to hidden anchors are skipped
+// NOTE: Controls are drawn in array order, topmost control is the one with higher index
+static int GetSpatialIndexControl(const LayoutSpatialIndex *index, const GuiLayout *layout, Vector2 point)
+{
+    int result = -1;
+
+    int cellX = (int)floorf(point.x/SPATIAL_INDEX_CELL_SIZE);
+    int cellY = (int)floorf(point.y/SPATIAL_INDEX_CELL_SIZE);
+    const SpatialIndexBucket *buckets[2] = { &index->buckets[GetSpatialIndexBucket(cellX, cellY)], &index->large };
+
+    for (int b = 0; b < 2; b++)
+    {
+        for (int i = 0; i < buckets[b]->count; i++)
+        {
+            int control = buckets[b]->controls[i];
+
+            if ((control > result) && !layout->anchors[layout->controls[control].anchorId].hidding &&
+                CheckCollisionPointRec(point, index->entries[control].rec)) result = control;
+        }
+    }
+
+    return result;
+}
+
+// Get spatial index bucket for grid cell
+static int GetSpatialIndexBucket(int cellX, int cellY)
+{
+    return (int)((((unsigned int)cellX*73856093u) ^ ((unsigned int)cellY*19349663u)) & (SPATIAL_INDEX_BUCKETS - 1));
+}
+
+// Add control to spatial index buckets, control entry must be already updated
+// NOTE: Controls covering too many cells are added to large controls bucket, always checked
+static void AddSpatialIndexControl(LayoutSpatialIndex *index, int control)
+{
+    SpatialIndexEntry *entry = &index->entries[control];
+    int cellCount = (entry->cells[2] - entry->cells[0] + 1)*(entry->cells[3] - entry->cells[1] + 1);
+
+    if ((cellCount <= 0) || (cellCount > SPATIAL_INDEX_MAX_CELLS)) AddSpatialIndexBucketControl(&index->large, control);
+    else
+    {
+        for (int y = entry->cells[1]; y <= entry->cells[3]; y++)
+        {
+            for (int x = entry->cells[0]; x <= entry->cells[2]; x++) AddSpatialIndexBucketControl(&index->buckets[GetSpatialIndexBucket(x, y)], control);
+        }
+    }
+
+    entry->indexed = true;
+}
+
+// Remove control from spatial index buckets (if indexed)
+static void RemoveSpatialIndexControl(LayoutSpatialIndex *index, int control)
+{
+    SpatialIndexEntry *entry = &index->entries[control];
+
+    if (!entry->indexed) return;
+
+    int cellCount = (entry->cells[2] - entry->cells[0] + 1)*(entry->cells[3] - entry->cells[1] + 1);
+
+    if ((cellCount <= 0) || (cellCount > SPATIAL_INDEX_MAX_CELLS)) RemoveSpatialIndexBucketControl(&index->large, control);
+    else
+    {
+        for (int y = entry->cells[1]; y <= entry->cells[3]; y++)
+        {
+            for (int x = entry->cells[0]; x <= entry->cells[2]; x++) RemoveSpatialIndexBucketControl(&index->buckets[GetSpatialIndexBucket(x, y)], control);
+        }
+    }
+
+    entry->indexed = false;
+}
+
+// Add control to spatial index bucket, storage grows if required
+// NOTE: Different cells could share a bucket, control is only added once
+static void AddSpatialIndexBucketControl(SpatialIndexBucket *bucket, int control)
+{
+    for (int i = 0; i < bucket->count; i++) if (bucket->controls[i] == control) return;
+
+    if (bucket->count >= bucket->capacity)
+    {
+        bucket->capacity = (bucket->capacity > 0)? bucket->capacity*2 : 8;
+        bucket->controls = (int *)RL_REALLOC(bucket->controls, bucket->capacity*sizeof(int));
+    }
+
+    bucket->controls[bucket->count] = control;
+    bucket->count++;
+}
+
+// Remove control from spatial index bucket (if available)
+static void RemoveSpatialIndexBucketControl(SpatialIndexBucket *bucket, int control)
+{
+    for (int i = 0; i < bucket->count; i++)
+    {
+        if (bucket->controls[i] == control)
+        {
+            bucket->controls[i] = bucket->controls[bucket->count - 1];
+            bucket->count--;
+            break;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------
+// Code generation worker functions (codegen window live code regeneration)
+//--------------------------------------------------------------------------------------------
+// Code generation worker thread, layout snapshot code is generated
+#if defined(PLATFORM_DESKTOP) && defined(_WIN32)
+static unsigned long __stdcall CodegenWorkerThread(void *data)
+#else
+static void *CodegenWorkerThread(void *data)
+#endif
+{
+    CodegenWorker *worker = (CodegenWorker *)data;
+
+    if (worker->config.template != NULL) worker->codeText = GenLayoutCodeTemplate(worker->codeTemplate, worker->layout, (Vector2){ 0.0f, 0.0f }, worker->config);
+
+#if defined(PLATFORM_DESKTOP)
+    ATOMIC_FETCH_ADD(&worker->finished, 1);
+#else
+    worker->finished = 1;
+#endif
+
+    return 0;
+}
+
+// Start code generation on layout snapshot, worker must be idle (generated code collected)
+// NOTE: If worker thread can not be created (or not supported), code is generated on calling thread
+static void StartCodegenWorker(CodegenWorker *worker, const GuiLayout *layout, const GuiCodeTemplate *codeTemplate, GuiLayoutConfig config)
+{
+    if (worker->active) return;
+
+    // Layout snapshot storage is kept between generations, only grows if required
+    if (worker->layout == NULL) worker->layout = LoadLayout(NULL);
+    CopyLayout(worker->layout, layout);
+
+    worker->config = config;
+    worker->codeTemplate = codeTemplate;
+    worker->codeText = NULL;
+    worker->finished = 0;
+    worker->active = true;
+
+#if defined(PLATFORM_DESKTOP)
+#if defined(_WIN32)
+    worker->thread = CreateThread(NULL, 0, CodegenWorkerThread, worker, 0, NULL);
+    worker->threadActive = (worker->thread != NULL);
+#else
+    worker->threadActive = (pthread_create(&worker->thread, NULL, CodegenWorkerThread, worker) == 0);
+#endif
+    if (!worker->threadActive) CodegenWorkerThread(worker);
+#else
+    CodegenWorkerThread(worker);
+#endif
+}
+
+// Check if code generation worker finished, generated code is available
+static bool IsCodegenWorkerFinished(CodegenWorker *worker)
+{
+    if (!worker->active) return false;
+
+#if defined(PLATFORM_DESKTOP)
+    return (ATOMIC_FETCH_ADD(&worker->finished, 0) > 0);
+#else
+    return (worker->finished > 0);
+#endif
+}
+
+// Wait for code generation worker, generated code ownership is returned (NULL if worker not active)
+static char *WaitCodegenWorker(CodegenWorker *worker)
+{
+    char *codeText = NULL;
+
+    if (worker->active)
+    {
+#if defined(PLATFORM_DESKTOP)
+        if (worker->threadActive)
+        {
+#if defined(_WIN32)
+            WaitForSingleObject(worker->thread, 0xffffffff);    // INFINITE
+            CloseHandle(worker->thread);
+#else
+            pthread_join(worker->thread, NULL);
+#endif
+            worker->threadActive = false;
+        }
+#endif
+        codeText = worker->codeText;
+        worker->codeText = NULL;
+        worker->active = false;
+    }
+
+    return codeText;
+}
+
+// Unload code generation worker, running generation is waited and discarded
+static void UnloadCodegenWorker(CodegenWorker *worker)
+{
+    RL_FREE(WaitCodegenWorker(worker));
+    if (worker->layout != NULL) UnloadLayout(worker->layout);
+    worker->layout = NULL;
 }
 
 /*
@@ -28,13 +28,23 @@
 #ifndef RGUILAYOUT_H
 #define RGUILAYOUT_H
 
-#define MAX_GUI_CONTROLS                256      // Maximum number of gui controls
-#define MAX_ANCHOR_POINTS                16      // Maximum number of anchor points
+#define GUI_CONTROLS_INITIAL_CAPACITY    64      // Initial capacity of layout controls (grows on demand)
+#define ANCHOR_POINTS_INITIAL_CAPACITY   16      // Initial capacity of layout anchor points (grows on demand)
+#define STRINGS_POOL_INITIAL_CAPACITY  4096      // Initial capacity of layout strings pool data (grows on demand)
+#define STRINGS_TABLE_INITIAL_CAPACITY  256      // Initial capacity of layout strings pool intern table (grows on demand)
 
 #define MAX_ANCHOR_NAME_LENGTH           64      // Maximum length of anchor name
 #define MAX_CONTROL_NAME_LENGTH          64      // Maximum length of control name
 #define MAX_CONTROL_TEXT_LENGTH         128      // Maximum length of control text
 
+#define RGL_FILE_VERSION_TEXT         "4.0"      // Layout text file version (.rgl)
+#define RGL_FILE_VERSION_BINARY         400      // Layout binary file version (.rgl)
+
+#define RGL_BINARY_NAME_SIZE             64      // Layout binary file: anchor/control name field size
+#define RGL_BINARY_TEXT_SIZE            128      // Layout binary file: control text field size
+#define RGL_BINARY_ANCHOR_SIZE   (4 + RGL_BINARY_NAME_SIZE + 4 + 4 + 4)                     // Layout binary file: anchor record size
+#define RGL_BINARY_CONTROL_SIZE  (4 + 4 + RGL_BINARY_NAME_SIZE + 4*4 + 4 + RGL_BINARY_TEXT_SIZE)  // Layout binary file: control record size
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -72,34 +82,67 @@ typedef enum {
 } GuiControlType;
 
 // Anchor point type
-typedef struct GuiAnchorPoint GuiAnchorPoint;
-struct GuiAnchorPoint {
+typedef struct {
     int id;
     int x;
     int y;
     bool enabled;
     bool hidding;
     char name[MAX_ANCHOR_NAME_LENGTH];     // 64 bytes
-    GuiAnchorPoint *ap;
-};
+    unsigned int generation;        // Anchor last change generation (layout generation)
+} GuiAnchorPoint;
+
+// Gui layout string reference
+// NOTE: String data is stored in layout strings pool
+typedef struct {
+    int offset;                     // String offset in layout strings pool
+    int length;                     // String length (not including terminator)
+} GuiLayoutString;
+
+// Gui layout strings pool
+// NOTE: Strings are stored null-terminated and interned (not duplicated), offset 0 is the empty string
+typedef struct {
+    char *data;                     // Strings data
+    int size;                       // Strings data used size
+    int capacity;                   // Strings data allocated capacity
+    int *table;                     // Interned strings hash table, strings offsets (0 means empty slot)
+    int tableCount;                 // Interned strings count
+    int tableCapacity;              // Interned strings hash table capacity (power of two)
+} GuiLayoutStringPool;
 
 // Gui layout control type
+// NOTE: Only control data accessed every frame (hit-test, drawing, anchor links)
 typedef struct {
-    int id;
     int type;
+    int anchorId;                   // Control anchor, index in layout anchors array
     Rectangle rec;
-    char name[MAX_CONTROL_NAME_LENGTH];    // 64 bytes
-    char text[MAX_CONTROL_TEXT_LENGTH];    // 128 bytes
-    GuiAnchorPoint *ap;
 } GuiLayoutControl;
 
+// Gui layout control info type
+// NOTE: Control data only accessed on edition, load/save and code generation
+typedef struct {
+    int id;
+    GuiLayoutString name;           // Control name (max MAX_CONTROL_NAME_LENGTH)
+    GuiLayoutString text;           // Control text (max MAX_CONTROL_TEXT_LENGTH)
+    unsigned int generation;        // Control last change generation (layout generation)
+} GuiLayoutControlInfo;
+
 // Gui layout type
+// NOTE: Controls and anchors arrays grow on demand, anchors are slots indexed by anchor id
+// Controls data is split in two parallel arrays (same index and capacity), per-frame data and info data
+// Layout generation is increased on every layout change, controls and anchors store their last change generation
 typedef struct {
     int controlCount;
     int anchorCount;
-    GuiLayoutControl controls[MAX_GUI_CONTROLS];    // 256 controls
-    GuiAnchorPoint anchors[MAX_ANCHOR_POINTS];      // 8 anchors
+    int controlCapacity;            // Controls arrays allocated capacity
+    int anchorCapacity;             // Anchors array allocated capacity (anchor slots)
+    GuiLayoutControl *controls;     // Controls array
+    GuiLayoutControlInfo *controlsInfo; // Controls info array
+    GuiAnchorPoint *anchors;        // Anchors array
+    GuiLayoutStringPool strings;    // Controls names and texts strings pool
     Rectangle refWindow;
+    unsigned int generation;        // Layout changes generation counter
+    bool dirty;                     // Layout changed since last load/save
 } GuiLayout;
 
 // Gui layout configuration for code exportation
@@ -114,8 +157,19 @@ typedef struct {
     bool defineTexts;
     bool fullComments;
     bool exportButtonFunctions;
+    bool cacheStaticControls;                 // Cache static controls into render texture (.c/.h templates)
 } GuiLayoutConfig;
 
+/***********************************************************************************
+*
+*   RGUILAYOUT_IMPLEMENTATION
+*
+*   NOTE: Types above can be shared by multiple translation units (i.e. layout runtime),
+*   globals and functions below are only defined where RGUILAYOUT_IMPLEMENTATION is defined
+*
+************************************************************************************/
+#if defined(RGUILAYOUT_IMPLEMENTATION)
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -149,4 +203,16 @@ const char *controlTypeName[] = {
     "DummyRec"
 };
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get layout string data from layout strings pool
+static const char *GetLayoutString(const GuiLayout *layout, GuiLayoutString string)
+{
+    return (layout->strings.data != NULL)? (layout->strings.data + string.offset) : "";
+}
+
+#endif // RGUILAYOUT_IMPLEMENTATION
+
 #endif // RGUILAYOUT_H
@@ -0,0 +1,720 @@
+/*******************************************************************************************
+*
+*   rGuiLayout benchmark - Layout load/save and code generation timings
+*
+*   DESCRIPTION:
+*       Layout load/save and code generation (all built-in templates) are measured over
+*       synthetic layouts (N controls, M anchors, mixed types) and layout files (.rgl),
+*       per-frame editor work (focus hit-test, controls iteration) is also measured
+*
+*       NOTE: No window is created, tool source is included with RGUILAYOUT_NO_MAIN
+*
+*   OUTPUT:
+*       Results are printed as JSON lines (one measure per line), i.e:
+*       {"layout":"synthetic_256x4","controls":256,"anchors":5,"measure":"gen","template":"standard",
+*        "iterations":16,"time_ms":0.123456,"bytes":12345,"allocs":12,"output_size":23456,"peak_rss_kb":4567}
+*
+*       time_ms, bytes and allocs are averaged per iteration, bytes are requested allocation bytes
+*       NOTE: Memory allocated internally by raylib (i.e. LoadFileData()) is not counted
+*
+*   GOLDEN OUTPUT:
+*       Generated code for every layout file, code template and GuiLayoutConfig flags combination
+*       (exportAnchors, defineRecs, defineTexts, fullComments, exportButtonFunctions, cacheStaticControls)
+*       can be saved (-G) into a directory, along with per-case timings (timings.txt), and checked later (-g)
+*
+*       On check, changed outputs are reported (actual output saved as <case>.actual) and cases slower
+*       than saved timings over threshold (--threshold, default 25%) are reported, exit code is 1 on failure
+*       Cases time is the best iteration time, less sensitive to system noise than average time
+*       NOTE: Golden outputs for layouts/ are kept in tests/golden/ (make test), timings are machine
+*       dependent and not part of the repository, slowdowns are only checked once timings are saved locally
+*
+*   USAGE:
+*       rguilayout_bench [-i <iterations>] [-s <controls>x<anchors>] [-t <template>]
+*                        [-g <golden_dir>] [-G <golden_dir>] [--threshold <percent>] [layouts...]
+*
+*       Layouts can be .rgl files or directories, by default layouts/ or ../layouts/ directory is used
+*       Synthetic layouts default to 256x4, 4096x16 and 65536x64, -s can be used multiple times
+*       Custom code templates can be added to built-in templates, -t can be used multiple times
+*
+*   BUILDING:
+*       make rguilayout_bench       (src/Makefile)
+*       make test                   (src/Makefile, golden outputs check)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2017-2026 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <stdlib.h>                         // Required for: malloc(), calloc(), realloc(), free()
+#include <stdio.h>                          // Required for: printf(), snprintf(), remove()
+#include <string.h>                         // Required for: strlen(), strcmp(), strncpy()
+
+#if defined(_WIN32)
+    // NOTE: Windows API declared below, windows.h is not included (symbols collision with raylib)
+#else
+    #include <time.h>                       // Required for: clock_gettime()
+    #include <sys/resource.h>               // Required for: getrusage()
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Memory allocators counting allocations, used by all included modules
+// NOTE: Only allocations are counted (free() is not tracked), memory can be allocated by raylib
+#define RL_MALLOC(sz)           BenchMalloc(sz)
+#define RL_CALLOC(n,sz)         BenchCalloc(n,sz)
+#define RL_REALLOC(ptr,sz)      BenchRealloc(ptr,sz)
+#define RL_FREE(ptr)            free(ptr)
+
+#define MAX_BENCH_SYNTHETIC         16      // Max synthetic layouts defined by command line (-s)
+#define MAX_BENCH_FILES            256      // Max layout files to benchmark
+#define MAX_BENCH_TEMPLATES          8      // Max code templates to benchmark (built-in and custom)
+
+#define GOLDEN_CONFIG_FLAGS          6      // GuiLayoutConfig flags combined for golden output cases
+#define GOLDEN_MIN_SLOWDOWN_MS    0.05      // Min case time increase to report a slowdown (measure noise)
+
+#define BENCH_LAYOUT_TEXT_FILE      "rguilayout_bench.rgl"      // Temporal file for text layout save/load
+#define BENCH_LAYOUT_BINARY_FILE    "rguilayout_bench.bin.rgl"  // Temporal file for binary layout save/load
+
+#if defined(_WIN32)
+int __stdcall QueryPerformanceCounter(long long *count);            // kernel32.lib
+int __stdcall QueryPerformanceFrequency(long long *frequency);      // kernel32.lib
+void *__stdcall GetCurrentProcess(void);                            // kernel32.lib
+int __stdcall K32GetProcessMemoryInfo(void *process, void *counters, unsigned long size);  // kernel32.lib (Windows 7)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (required by allocators macros)
+//----------------------------------------------------------------------------------
+static void *BenchMalloc(size_t size);                  // Allocate memory, allocation counted
+static void *BenchCalloc(size_t count, size_t size);    // Allocate memory (zero initialized), allocation counted
+static void *BenchRealloc(void *ptr, size_t size);      // Reallocate memory, allocation counted
+
+// Tool source included, main entry point excluded
+// NOTE: Editor functions and variables are not used by benchmark, unused warnings are disabled
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+    #pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+#define RGUILAYOUT_NO_MAIN
+#include "rguilayout.c"
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark measure
+typedef struct {
+    double startTime;               // Measure start time (seconds)
+    unsigned long long startBytes;  // Measure start allocated bytes
+    unsigned long long startAllocs; // Measure start allocations count
+} BenchMeasure;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static unsigned long long benchAllocBytes = 0;  // Allocated bytes (requested), accumulated
+static unsigned long long benchAllocCount = 0;  // Allocations count, accumulated
+
+static int benchIterations = 16;                // Iterations per measure (scaled down for big layouts)
+static float goldenThreshold = 25.0f;           // Golden output cases slowdown threshold (percent over saved time)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetBenchTime(void);               // Get monotonic time in seconds
+static long GetBenchPeakMemory(void);           // Get process peak resident memory (KB)
+
+static BenchMeasure BeginBenchMeasure(void);    // Begin measure, current time and allocations registered
+static void EndBenchMeasure(BenchMeasure measure, const char *layoutName, const GuiLayout *layout, const char *measureName, const char *templateName, int iterations, int outputSize); // End measure, results printed
+
+static char *GenSyntheticLayoutText(int controlCount, int anchorCount);     // Generate synthetic layout text data (.rgl), mixed controls types
+static int GetBenchIterations(const GuiLayout *layout);                     // Get iterations per measure for layout (scaled down for big layouts)
+static void BenchLayout(const char *layoutName, const char *fileName, const GuiCodeTemplate *codeTemplates, const char **templateNames, int templateCount);  // Run all measures over layout file
+static void BenchLayoutFrame(const char *layoutName, GuiLayout *layout);   // Run per-frame editor measures over layout
+
+static int CheckLayoutGolden(const char *layoutName, const char *fileName, const GuiCodeTemplate *codeTemplates, const char **templateNames, int templateCount, const char *goldenPath, const char *timings, FILE *timingsFile); // Check (or save) layout golden outputs, returns failed cases
+static double GetGoldenTiming(const char *timings, const char *caseName);  // Get golden case saved time (ms), -1 if not available
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messsages
+
+    int syntheticControls[MAX_BENCH_SYNTHETIC] = { 256, 4096, 65536 };
+    int syntheticAnchors[MAX_BENCH_SYNTHETIC] = { 4, 16, 64 };
+    int syntheticCount = 0;
+
+    char (*fileNames)[512] = (char (*)[512])RL_CALLOC(MAX_BENCH_FILES, 512);
+    int fileCount = 0;
+    bool pathsProvided = false;
+
+    // Code templates, built-in templates first, custom templates added by command line (-t)
+    // NOTE: Custom templates text must be kept alive while compiled templates are used
+    GuiCodeTemplate codeTemplates[MAX_BENCH_TEMPLATES] = { 0 };
+    const char *templateNames[MAX_BENCH_TEMPLATES] = { "standard", "header_only", "table", "constexpr_cpp" };
+    char *templateTexts[MAX_BENCH_TEMPLATES] = { 0 };
+    int templateCount = 4;
+
+    char goldenPath[512] = { 0 };
+    bool goldenSave = false;
+
+    // Process command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-i") == 0) && ((i + 1) < argc))
+        {
+            benchIterations = TextToInteger(argv[++i]);
+            if (benchIterations < 1) benchIterations = 1;
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && ((i + 1) < argc))
+        {
+            int controls = 0;
+            int anchors = 0;
+
+            if ((sscanf(argv[++i], "%dx%d", &controls, &anchors) == 2) && (controls >= 0) && (anchors >= 0) && (syntheticCount < MAX_BENCH_SYNTHETIC))
+            {
+                syntheticControls[syntheticCount] = controls;
+                syntheticAnchors[syntheticCount] = anchors;
+                syntheticCount++;
+            }
+            else printf("WARNING: Synthetic layout not valid (<controls>x<anchors>): %s\n", argv[i]);
+        }
+        else if ((strcmp(argv[i], "-t") == 0) && ((i + 1) < argc))
+        {
+            char *text = LoadFileText(argv[++i]);
+
+            if ((text != NULL) && (templateCount < MAX_BENCH_TEMPLATES))
+            {
+                templateTexts[templateCount] = text;
+                templateNames[templateCount] = GetFileName(argv[i]);     // NOTE: Points to argv string
+                templateCount++;
+            }
+            else
+            {
+                printf("WARNING: Code template could not be loaded: %s\n", argv[i]);
+                RL_FREE(text);
+            }
+        }
+        else if (((strcmp(argv[i], "-g") == 0) || (strcmp(argv[i], "-G") == 0)) && ((i + 1) < argc))
+        {
+            goldenSave = (argv[i][1] == 'G');
+            strncpy(goldenPath, argv[++i], 511);
+        }
+        else if ((strcmp(argv[i], "--threshold") == 0) && ((i + 1) < argc))
+        {
+            goldenThreshold = TextToFloat(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            printf("USAGE: rguilayout_bench [-i <iterations>] [-s <controls>x<anchors>] [-t <template>]\n");
+            printf("                        [-g <golden_dir>] [-G <golden_dir>] [--threshold <percent>] [layouts...]\n");
+            RL_FREE(fileNames);
+            return 0;
+        }
+        else
+        {
+            pathsProvided = true;
+
+            if (DirectoryExists(argv[i]))
+            {
+                FilePathList files = LoadDirectoryFilesEx(argv[i], ".rgl", false);
+                for (unsigned int f = 0; (f < files.count) && (fileCount < MAX_BENCH_FILES); f++) strncpy(fileNames[fileCount++], files.paths[f], 511);
+                UnloadDirectoryFiles(files);
+            }
+            else if (fileCount < MAX_BENCH_FILES) strncpy(fileNames[fileCount++], argv[i], 511);
+        }
+    }
+
+    if (syntheticCount == 0) syntheticCount = 3;
+
+    // Default layouts directory, depending on working directory
+    if (!pathsProvided)
+    {
+        const char *layoutsPath = DirectoryExists("layouts")? "layouts" : "../layouts";
+
+        if (DirectoryExists(layoutsPath))
+        {
+            FilePathList files = LoadDirectoryFilesEx(layoutsPath, ".rgl", false);
+            for (unsigned int f = 0; (f < files.count) && (fileCount < MAX_BENCH_FILES); f++) strncpy(fileNames[fileCount++], files.paths[f], 511);
+            UnloadDirectoryFiles(files);
+        }
+    }
+
+    // Load code templates, compiled once
+    codeTemplates[0] = LoadCodeTemplate(guiTemplateStandardCode);
+    codeTemplates[1] = LoadCodeTemplate(guiTemplateHeaderOnly);
+    codeTemplates[2] = LoadCodeTemplate(guiTemplateTable);
+    codeTemplates[3] = LoadCodeTemplate(guiTemplateConstexpr);
+    for (int i = 4; i < templateCount; i++) codeTemplates[i] = LoadCodeTemplate(templateTexts[i]);
+
+    int result = 0;
+
+    if (goldenPath[0] != '\0')
+    {
+        // Golden outputs check (or save), only layout files are used
+        // NOTE: Timings are saved along golden outputs, required to check slowdowns
+        const char *timingsFileName = TextFormat("%s/timings.txt", goldenPath);
+        char *timings = NULL;
+        FILE *timingsFile = NULL;
+        bool goldenAvailable = DirectoryExists(goldenPath);
+        int failedCount = 0;
+        int caseCount = 0;
+
+        if (!goldenAvailable) printf("ERROR: Golden outputs directory not found: %s\n", goldenPath);
+        else if (goldenSave) timingsFile = fopen(timingsFileName, "wt");
+        else timings = LoadFileText(timingsFileName);
+
+        for (int i = 0; (i < fileCount) && goldenAvailable; i++)
+        {
+            if (FileExists(fileNames[i]))
+            {
+                failedCount += CheckLayoutGolden(GetFileNameWithoutExt(fileNames[i]), fileNames[i], codeTemplates, templateNames, templateCount, goldenPath, timings, timingsFile);
+                caseCount += templateCount*(1 << GOLDEN_CONFIG_FLAGS);
+            }
+            else
+            {
+                printf("ERROR: Layout file not found: %s\n", fileNames[i]);
+                failedCount++;
+            }
+        }
+
+        printf("{\"golden_cases\":%i,\"failed\":%i,\"threshold\":%.2f}\n", caseCount, failedCount, goldenThreshold);
+
+        if (timingsFile != NULL) fclose(timingsFile);
+        RL_FREE(timings);
+
+        result = ((failedCount > 0) || !goldenAvailable)? 1 : 0;
+    }
+    else
+    {
+        // Synthetic layouts measures
+        // NOTE: Layout text is saved to file, measures are the same as for layout files
+        for (int i = 0; i < syntheticCount; i++)
+        {
+            char *text = GenSyntheticLayoutText(syntheticControls[i], syntheticAnchors[i]);
+            char layoutName[64] = { 0 };
+            snprintf(layoutName, 64, "synthetic_%ix%i", syntheticControls[i], syntheticAnchors[i]);
+
+            if (SaveFileText(BENCH_LAYOUT_TEXT_FILE, text)) BenchLayout(layoutName, BENCH_LAYOUT_TEXT_FILE, codeTemplates, templateNames, templateCount);
+            else printf("ERROR: Synthetic layout could not be saved: %s\n", BENCH_LAYOUT_TEXT_FILE);
+
+            RL_FREE(text);
+        }
+
+        // Layout files measures
+        for (int i = 0; i < fileCount; i++)
+        {
+            if (FileExists(fileNames[i])) BenchLayout(GetFileNameWithoutExt(fileNames[i]), fileNames[i], codeTemplates, templateNames, templateCount);
+            else printf("ERROR: Layout file not found: %s\n", fileNames[i]);
+        }
+
+        remove(BENCH_LAYOUT_TEXT_FILE);
+        remove(BENCH_LAYOUT_BINARY_FILE);
+    }
+
+    for (int i = 0; i < templateCount; i++)
+    {
+        UnloadCodeTemplate(codeTemplates[i]);
+        RL_FREE(templateTexts[i]);
+    }
+
+    RL_FREE(fileNames);
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Allocate memory, allocation counted
+static void *BenchMalloc(size_t size)
+{
+    benchAllocBytes += size;
+    benchAllocCount++;
+
+    return malloc(size);
+}
+
+// Allocate memory (zero initialized), allocation counted
+static void *BenchCalloc(size_t count, size_t size)
+{
+    benchAllocBytes += count*size;
+    benchAllocCount++;
+
+    return calloc(count, size);
+}
+
+// Reallocate memory, allocation counted
+// NOTE: Full new size is counted, reallocation could require a copy
+static void *BenchRealloc(void *ptr, size_t size)
+{
+    benchAllocBytes += size;
+    benchAllocCount++;
+
+    return realloc(ptr, size);
+}
+
+// Get monotonic time in seconds
+// NOTE: raylib GetTime() requires an initialized window
+static double GetBenchTime(void)
+{
+#if defined(_WIN32)
+    long long counter = 0;
+    long long frequency = 1;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter/(double)frequency;
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+// Get process peak resident memory (KB)
+static long GetBenchPeakMemory(void)
+{
+#if defined(_WIN32)
+    // NOTE: PROCESS_MEMORY_COUNTERS structure, only peak working set size is required
+    struct {
+        unsigned long cb;
+        unsigned long pageFaultCount;
+        size_t peakWorkingSetSize;
+        size_t workingSetSize;
+        size_t quotaPeakPagedPoolUsage;
+        size_t quotaPagedPoolUsage;
+        size_t quotaPeakNonPagedPoolUsage;
+        size_t quotaNonPagedPoolUsage;
+        size_t pagefileUsage;
+        size_t peakPagefileUsage;
+    } counters = { 0 };
+
+    counters.cb = sizeof(counters);
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return (long)(counters.peakWorkingSetSize/1024);
+
+    return 0;
+#else
+    struct rusage usage = { 0 };
+    getrusage(RUSAGE_SELF, &usage);
+
+    #if defined(__APPLE__)
+        return usage.ru_maxrss/1024;        // NOTE: macOS reports bytes
+    #else
+        return usage.ru_maxrss;
+    #endif
+#endif
+}
+
+// Begin measure, current time and allocations registered
+static BenchMeasure BeginBenchMeasure(void)
+{
+    BenchMeasure measure = { 0 };
+
+    measure.startBytes = benchAllocBytes;
+    measure.startAllocs = benchAllocCount;
+    measure.startTime = GetBenchTime();
+
+    return measure;
+}
+
+// End measure, results printed (one JSON line)
+// NOTE: Time and allocations are averaged per iteration
+static void EndBenchMeasure(BenchMeasure measure, const char *layoutName, const GuiLayout *layout, const char *measureName, const char *templateName, int iterations, int outputSize)
+{
+    double time = GetBenchTime() - measure.startTime;
+
+    printf("{\"layout\":\"%s\",\"controls\":%i,\"anchors\":%i,\"measure\":\"%s\",\"template\":\"%s\",\"iterations\":%i,"
+           "\"time_ms\":%.6f,\"bytes\":%llu,\"allocs\":%llu,\"output_size\":%i,\"peak_rss_kb\":%li}\n",
+           layoutName, layout->controlCount, layout->anchorCount, measureName, (templateName != NULL)? templateName : "", iterations,
+           time*1000.0/iterations, (benchAllocBytes - measure.startBytes)/iterations, (benchAllocCount - measure.startAllocs)/iterations,
+           outputSize, GetBenchPeakMemory());
+
+    fflush(stdout);
+}
+
+// Generate synthetic layout text data (.rgl), mixed controls types
+// NOTE: Controls are distributed over anchors, half the controls share the same text (strings interning)
+static char *GenSyntheticLayoutText(int controlCount, int anchorCount)
+{
+    int size = 256 + anchorCount*128 + controlCount*128;
+    char *text = (char *)RL_CALLOC(size, 1);
+    int length = 0;
+    unsigned int seed = 0x12345678;
+
+    length += snprintf(text + length, size - length, "#\n# rgl layout text file (v%s) - synthetic layout (rguilayout_bench)\n#\nr 0 40 1280 720\n", RGL_FILE_VERSION_TEXT);
+
+    for (int i = 1; i <= anchorCount; i++)
+    {
+        length += snprintf(text + length, size - length, "a %03i anchor%02i %i %i 1\n", i, i, 24 + (i%16)*64, 24 + (i/16)*48);
+    }
+
+    for (int i = 0; i < controlCount; i++)
+    {
+        // Simple linear congruential generator, deterministic controls placement
+        seed = seed*1664525u + 1013904223u;
+
+        int type = i%(GUI_DUMMYREC + 1);
+        const char *controlText = NULL;
+
+        switch (type)
+        {
+            case GUI_TOGGLEGROUP:
+            case GUI_COMBOBOX:
+            case GUI_DROPDOWNBOX:
+            case GUI_LISTVIEW: controlText = "ONE;TWO;THREE"; break;
+            default: controlText = (i%2)? "SAMPLE TEXT" : TextFormat("#%03i#Control %i", i%220, i); break;
+        }
+
+        length += snprintf(text + length, size - length, "c %03i %i %s%03i %i %i %i %i %i %s\n", i, type, controlTypeName[type], i,
+            (int)((seed >> 8)%1200), (int)((seed >> 16)%680), 24 + (int)(seed%8)*24, 24 + (int)((seed >> 4)%4)*8, (anchorCount > 0)? (i%(anchorCount + 1)) : 0, controlText);
+    }
+
+    return text;
+}
+
+// Get iterations per measure for layout
+// NOTE: Iterations scaled down for big layouts, measures take a similar time
+static int GetBenchIterations(const GuiLayout *layout)
+{
+    int iterations = benchIterations;
+    if (layout->controlCount > 1024) iterations = benchIterations*1024/layout->controlCount;
+    if (iterations < 1) iterations = 1;
+
+    return iterations;
+}
+
+// Run all measures over layout file: load, save, code generation and per-frame editor work
+static void BenchLayout(const char *layoutName, const char *fileName, const GuiCodeTemplate *codeTemplates, const char **templateNames, int templateCount)
+{
+    GuiLayout *layout = LoadLayout(fileName);
+    int iterations = GetBenchIterations(layout);
+
+    // Layout loading (text)
+    BenchMeasure measure = BeginBenchMeasure();
+    for (int i = 0; i < iterations; i++) UnloadLayout(LoadLayout(fileName));
+    EndBenchMeasure(measure, layoutName, layout, "load", NULL, iterations, GetFileLength(fileName));
+
+    // Layout saving and loading (text and binary)
+    measure = BeginBenchMeasure();
+    for (int i = 0; i < iterations; i++) SaveLayout(layout, BENCH_LAYOUT_TEXT_FILE, false);
+    EndBenchMeasure(measure, layoutName, layout, "save_text", NULL, iterations, GetFileLength(BENCH_LAYOUT_TEXT_FILE));
+
+    measure = BeginBenchMeasure();
+    for (int i = 0; i < iterations; i++) SaveLayout(layout, BENCH_LAYOUT_BINARY_FILE, true);
+    EndBenchMeasure(measure, layoutName, layout, "save_binary", NULL, iterations, GetFileLength(BENCH_LAYOUT_BINARY_FILE));
+
+    measure = BeginBenchMeasure();
+    for (int i = 0; i < iterations; i++) UnloadLayout(LoadLayout(BENCH_LAYOUT_BINARY_FILE));
+    EndBenchMeasure(measure, layoutName, layout, "load_binary", NULL, iterations, GetFileLength(BENCH_LAYOUT_BINARY_FILE));
+
+    // Code generation, all built-in templates
+    GuiLayoutConfig config = { 0 };
+    strcpy(config.name, "window_bench");
+    strcpy(config.version, TOOL_VERSION);
+    strcpy(config.company, "raylib technologies");
+    strcpy(config.description, "tool description");
+    config.exportAnchors = true;
+    config.fullComments = true;
+
+    for (int t = 0; t < templateCount; t++)
+    {
+        int outputSize = 0;
+
+        measure = BeginBenchMeasure();
+        for (int i = 0; i < iterations; i++)
+        {
+            char *code = GenLayoutCodeTemplate(&codeTemplates[t], layout, (Vector2){ 0.0f, 0.0f }, config);
+            if (code != NULL) outputSize = (int)strlen(code);
+            RL_FREE(code);
+        }
+        EndBenchMeasure(measure, layoutName, layout, "gen", templateNames[t], iterations, outputSize);
+    }
+
+    BenchLayoutFrame(layoutName, layout);
+
+    UnloadLayout(layout);
+}
+
+// Run per-frame editor measures over layout
+// NOTE: Frames are simulated, one control moved and focused control found every frame
+static void BenchLayoutFrame(const char *layoutName, GuiLayout *layout)
+{
+    const int frameCount = 256;
+    LayoutSpatialIndex spatialIndex = { 0 };
+    volatile int focusedControl = -1;
+
+    if (layout->controlCount == 0) return;
+
+    // Initial spatial index build, all controls indexed
+    BenchMeasure measure = BeginBenchMeasure();
+    SyncSpatialIndex(&spatialIndex, layout);
+    EndBenchMeasure(measure, layoutName, layout, "frame_index_build", NULL, 1, 0);
+
+    // Focus: spatial index sync (one control changed) and topmost control at mouse position
+    measure = BeginBenchMeasure();
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        int index = (frame*7919)%layout->controlCount;
+        layout->controls[index].rec.x += (frame%2)? -8.0f : 8.0f;
+        MarkLayoutControlChanged(layout, index);
+
+        SyncSpatialIndex(&spatialIndex, layout);
+        focusedControl = GetSpatialIndexControl(&spatialIndex, layout, (Vector2){ (float)((frame*37)%1280), (float)(40 + (frame*23)%720) });
+    }
+    EndBenchMeasure(measure, layoutName, layout, "frame_focus", NULL, frameCount, 0);
+
+    // Controls iteration: anchored controls rectangles, as required for controls drawing
+    measure = BeginBenchMeasure();
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        int visibleCount = 0;
+
+        for (int i = 0; i < layout->controlCount; i++)
+        {
+            if (!layout->anchors[layout->controls[i].anchorId].hidding)
+            {
+                Vector2 anchorOffset = (Vector2){ 0, 0 };
+                if (layout->controls[i].anchorId > 0) anchorOffset = (Vector2){ layout->anchors[layout->controls[i].anchorId].x, layout->anchors[layout->controls[i].anchorId].y };
+                Rectangle rec = { anchorOffset.x + layout->controls[i].rec.x, anchorOffset.y + layout->controls[i].rec.y, layout->controls[i].rec.width, layout->controls[i].rec.height };
+
+                if ((rec.x < 1280.0f) && (rec.y < 760.0f)) visibleCount++;
+            }
+        }
+
+        focusedControl = visibleCount;
+    }
+    EndBenchMeasure(measure, layoutName, layout, "frame_iterate", NULL, frameCount, 0);
+
+    UnloadSpatialIndex(&spatialIndex);
+    (void)focusedControl;
+}
+
+// Check layout golden outputs, every code template and config flags combination, returns failed cases
+// NOTE: If timings file provided, golden outputs and timings are saved instead of checked
+static int CheckLayoutGolden(const char *layoutName, const char *fileName, const GuiCodeTemplate *codeTemplates, const char **templateNames, int templateCount, const char *goldenPath, const char *timings, FILE *timingsFile)
+{
+    GuiLayout *layout = LoadLayout(fileName);
+    int iterations = GetBenchIterations(layout);
+    int failedCount = 0;
+
+    GuiLayoutConfig config = { 0 };
+    strncpy(config.name, layoutName, 63);
+    strcpy(config.version, TOOL_VERSION);
+    strcpy(config.company, "raylib technologies");
+    strcpy(config.description, "tool description");
+
+    for (int t = 0; t < templateCount; t++)
+    {
+        for (int flags = 0; flags < (1 << GOLDEN_CONFIG_FLAGS); flags++)
+        {
+            // Case name: <layout>.<template>.<flags>, disabled flags as '-'
+            char flagsText[GOLDEN_CONFIG_FLAGS + 1] = { 0 };
+            for (int f = 0; f < GOLDEN_CONFIG_FLAGS; f++) flagsText[f] = (flags & (1 << f))? "artcbs"[f] : '-';
+
+            char caseName[256] = { 0 };
+            char caseFileName[1024] = { 0 };
+            snprintf(caseName, 256, "%s.%s.%s", layoutName, templateNames[t], flagsText);
+            snprintf(caseFileName, 1024, "%s/%s.txt", goldenPath, caseName);
+
+            config.exportAnchors = (flags & 0x01)? true : false;
+            config.defineRecs = (flags & 0x02)? true : false;
+            config.defineTexts = (flags & 0x04)? true : false;
+            config.fullComments = (flags & 0x08)? true : false;
+            config.exportButtonFunctions = (flags & 0x10)? true : false;
+            config.cacheStaticControls = (flags & 0x20)? true : false;
+
+            // Code generation best time over iterations (less sensitive to system noise), last generated code kept
+            char *code = NULL;
+            double time = 0.0;
+            for (int i = 0; i < iterations; i++)
+            {
+                RL_FREE(code);
+
+                double startTime = GetBenchTime();
+                code = GenLayoutCodeTemplate(&codeTemplates[t], layout, (Vector2){ 0.0f, 0.0f }, config);
+                double iterationTime = (GetBenchTime() - startTime)*1000.0;
+
+                if ((i == 0) || (iterationTime < time)) time = iterationTime;
+            }
+
+            int codeSize = (code != NULL)? (int)strlen(code) : 0;
+            double savedTime = -1.0;
+            const char *status = "ok";
+
+            if (timingsFile != NULL)
+            {
+                if (SaveFileData(caseFileName, code, codeSize)) fprintf(timingsFile, "%s %.6f\n", caseName, time);
+                else status = "error";
+            }
+            else
+            {
+                int goldenSize = 0;
+                unsigned char *golden = LoadFileData(caseFileName, &goldenSize);
+                savedTime = GetGoldenTiming(timings, caseName);
+
+                if (golden == NULL) status = "missing";
+                else if ((goldenSize != codeSize) || (memcmp(golden, code, codeSize) != 0))
+                {
+                    // Actual output saved along golden output for inspection
+                    SaveFileData(TextFormat("%s.actual", caseFileName), code, codeSize);
+                    status = "changed";
+                }
+                else if ((savedTime > 0.0) && (time > savedTime*(1.0 + goldenThreshold/100.0)) && ((time - savedTime) > GOLDEN_MIN_SLOWDOWN_MS)) status = "slower";
+
+                UnloadFileData(golden);
+            }
+
+            if (strcmp(status, "ok") != 0) failedCount++;
+
+            printf("{\"layout\":\"%s\",\"template\":\"%s\",\"flags\":\"%s\",\"iterations\":%i,\"time_ms\":%.6f,\"saved_time_ms\":%.6f,\"output_size\":%i,\"status\":\"%s\"}\n",
+                   layoutName, templateNames[t], flagsText, iterations, time, savedTime, codeSize, status);
+
+            RL_FREE(code);
+        }
+    }
+
+    fflush(stdout);
+    UnloadLayout(layout);
+
+    return failedCount;
+}
+
+// Get golden case saved time (ms), -1 if not available
+// NOTE: Timings text lines format: <case_name> <time_ms>
+static double GetGoldenTiming(const char *timings, const char *caseName)
+{
+    int length = (int)strlen(caseName);
+
+    for (const char *line = timings; (line != NULL) && (*line != '\0'); line = strchr(line, '\n'))
+    {
+        if (*line == '\n') line++;
+        if ((strncmp(line, caseName, length) == 0) && (line[length] == ' ')) return atof(line + length + 1);
+    }
+
+    return -1.0;
+}
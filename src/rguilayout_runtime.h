@@ -0,0 +1,672 @@
+/**********************************************************************************************
+*
+*   rGuiLayout - Layout Runtime
+*
+*   DESCRIPTION:
+*       Load layouts (.rgl, text or binary) at runtime and draw them with raygui, no code
+*       generation required: layout changes only require reloading the layout file
+*
+*       Layout controls data is loaded into flat arrays (drawing order) and controls state
+*       is kept by the runtime, same state semantics as generated code
+*
+*   MODULE USAGE:
+*       #define RGUILAYOUT_RUNTIME_IMPLEMENTATION
+*       #include "rguilayout_runtime.h"
+*
+*       INIT: GuiLayoutRuntime layout = LoadLayoutRuntime("my_layout.rgl");
+*       DRAW: DrawLayoutRuntime(&layout);
+*       STATE: GuiLayoutControlState *btnSave = GetLayoutRuntimeControlState(&layout, "btnSave");
+*       DEINIT: UnloadLayoutRuntime(layout);
+*
+*   NOTE: Controls positions are relative to layout reference window, anchors position
+*   could be changed at runtime to move all controls linked to that anchor
+*
+*   DEPENDENCIES:
+*       raylib 4.6-dev      - File loading: LoadFileData(), UnloadFileData()
+*       raygui 5.0-dev      - Controls drawing, implementation expected to be defined by the user
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2018-2022 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rguilayout.h"                 // Gui layout types definition (controls types, file format)
+
+#ifndef RGUILAYOUT_RUNTIME_H
+#define RGUILAYOUT_RUNTIME_H
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Layout runtime control state
+// NOTE: Every control type only uses its own fields
+typedef struct {
+    bool active;                    // WindowBox, Toggle: active, CheckBox: checked, Button, LabelButton: pressed
+    bool editMode;                  // DropdownBox, TextBox, ValueBox, Spinner: edit mode
+    int value;                      // ToggleGroup, ComboBox, DropdownBox, ListView: active, ValueBox, Spinner: value
+    int scrollIndex;                // ListView: scroll index
+    float valuef;                   // Slider, SliderBar, ProgressBar: value
+    Color color;                    // ColorPicker: value
+    Rectangle scrollView;           // ScrollPanel: scroll view
+    Vector2 scrollOffset;           // ScrollPanel: scroll offset
+    Vector2 boundsOffset;           // ScrollPanel: bounds offset
+    char *text;                     // TextBox, TextBoxMulti: editable text (MAX_CONTROL_TEXT_LENGTH), NULL otherwise
+} GuiLayoutControlState;
+
+// Layout runtime type
+// NOTE: Controls are stored in drawing order: every window box followed by the controls
+// linked to same anchor, then the rest of controls and finally dropdowns (drawn on top)
+typedef struct {
+    int controlCount;               // Controls count
+    int anchorCount;                // Anchors count (anchor slots, anchor id as index)
+    GuiLayoutControl *controls;     // Controls data: type, anchor id and rectangle (relative to anchor)
+    GuiLayoutControlState *states;  // Controls state
+    int *parents;                   // Controls parent window box (control index, -1 if none)
+    int *names;                     // Controls name offset in strings data
+    int *texts;                     // Controls text offset in strings data (-1 if no text)
+    char *strings;                  // Controls names and texts data (null-terminated)
+    char *editTexts;                // Editable texts data (TextBox controls)
+    Vector2 *anchors;               // Anchors position (anchor id as index, anchor 0 is reference window)
+    Rectangle refWindow;            // Layout reference window
+} GuiLayoutRuntime;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiLayoutRuntime LoadLayoutRuntime(const char *fileName);                                   // Load layout runtime from file (.rgl, text or binary)
+GuiLayoutRuntime LoadLayoutRuntimeFromMemory(const unsigned char *fileData, int dataSize);  // Load layout runtime from file data (.rgl, text or binary)
+void UnloadLayoutRuntime(GuiLayoutRuntime layout);                                          // Unload layout runtime
+void ResetLayoutRuntimeState(GuiLayoutRuntime *layout);                                     // Reset layout controls state to default values
+void DrawLayoutRuntime(GuiLayoutRuntime *layout);                                           // Draw layout controls (controls state is updated)
+
+int GetLayoutRuntimeControl(const GuiLayoutRuntime *layout, const char *name);              // Get layout control index by name (-1 if not found)
+GuiLayoutControlState *GetLayoutRuntimeControlState(GuiLayoutRuntime *layout, const char *name);   // Get layout control state by name (NULL if not found)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGUILAYOUT_RUNTIME_H
+
+/***********************************************************************************
+*
+*   RGUILAYOUT_RUNTIME_IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(RGUILAYOUT_RUNTIME_IMPLEMENTATION)
+
+// WARNING: raygui implementation is expected to be defined before including this header
+#undef RAYGUI_IMPLEMENTATION
+#include "raygui.h"
+
+#include <stdlib.h>         // Required for: strtol(), strtof()
+#include <string.h>         // Required for: strlen(), strcmp(), strchr(), strncpy(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Layout runtime control record (loading)
+// NOTE: Name and text reference layout file data, copied once into runtime strings data
+typedef struct {
+    GuiLayoutControl control;       // Control data
+    const char *name;               // Control name
+    const char *text;               // Control text
+    int nameLength;                 // Control name length
+    int textLength;                 // Control text length
+} LayoutRuntimeRecord;
+
+// Layout runtime records (loading)
+typedef struct {
+    LayoutRuntimeRecord *records;   // Controls records, file order
+    int count;                      // Controls records count
+    int capacity;                   // Controls records allocated capacity
+    Vector2 *anchors;               // Anchors position (anchor id as index)
+    int anchorCount;                // Anchors slots count
+    Rectangle refWindow;            // Layout reference window
+} LayoutRuntimeRecords;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void LoadLayoutRuntimeText(LayoutRuntimeRecords *records, char *text);                                  // Load layout records from text file data (tokenized in place)
+static void LoadLayoutRuntimeBinary(LayoutRuntimeRecords *records, const unsigned char *data, int size);       // Load layout records from binary file data
+static LayoutRuntimeRecord *AddLayoutRuntimeRecord(LayoutRuntimeRecords *records);                             // Add control record, records grow on demand
+static void SetLayoutRuntimeAnchor(LayoutRuntimeRecords *records, int id, Vector2 position);                  // Set anchor position, anchors grow on demand
+static GuiLayoutRuntime BuildLayoutRuntime(const LayoutRuntimeRecords *records);                               // Build layout runtime from records (drawing order)
+static const char *ScanRuntimeWord(const char *ptr, const char **word, int *length);                           // Scan word token (no blanks)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load layout runtime from file (.rgl, text or binary)
+GuiLayoutRuntime LoadLayoutRuntime(const char *fileName)
+{
+    GuiLayoutRuntime layout = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        layout = LoadLayoutRuntimeFromMemory(fileData, dataSize);
+        UnloadFileData(fileData);
+    }
+
+    return layout;
+}
+
+// Load layout runtime from file data (.rgl, text or binary)
+// NOTE: Binary or text format is detected by signature
+GuiLayoutRuntime LoadLayoutRuntimeFromMemory(const unsigned char *fileData, int dataSize)
+{
+    GuiLayoutRuntime layout = { 0 };
+    LayoutRuntimeRecords records = { 0 };
+
+    if ((fileData == NULL) || (dataSize <= 0)) return layout;
+
+    if ((dataSize >= 4) && (memcmp(fileData, "rGL ", 4) == 0))
+    {
+        LoadLayoutRuntimeBinary(&records, fileData, dataSize);
+        layout = BuildLayoutRuntime(&records);
+    }
+    else
+    {
+        // NOTE: Text data is copied null-terminated, lines are tokenized in place
+        char *text = (char *)RL_MALLOC(dataSize + 1);
+        memcpy(text, fileData, dataSize);
+        text[dataSize] = '\0';
+
+        LoadLayoutRuntimeText(&records, text);
+        layout = BuildLayoutRuntime(&records);
+
+        RL_FREE(text);
+    }
+
+    RL_FREE(records.records);
+    RL_FREE(records.anchors);
+
+    return layout;
+}
+
+// Unload layout runtime
+void UnloadLayoutRuntime(GuiLayoutRuntime layout)
+{
+    RL_FREE(layout.controls);
+    RL_FREE(layout.states);
+    RL_FREE(layout.parents);
+    RL_FREE(layout.names);
+    RL_FREE(layout.texts);
+    RL_FREE(layout.strings);
+    RL_FREE(layout.editTexts);
+    RL_FREE(layout.anchors);
+}
+
+// Reset layout controls state to default values
+// NOTE: Window boxes and toggles are active by default, text boxes text is reset to control text
+void ResetLayoutRuntimeState(GuiLayoutRuntime *layout)
+{
+    char *editText = layout->editTexts;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        GuiLayoutControlState *state = &layout->states[i];
+
+        memset(state, 0, sizeof(GuiLayoutControlState));
+
+        switch (layout->controls[i].type)
+        {
+            case GUI_WINDOWBOX:
+            case GUI_TOGGLE: state->active = true; break;
+            case GUI_TEXTBOX:
+            case GUI_TEXTBOXMULTI:
+            {
+                state->text = editText;
+                editText += MAX_CONTROL_TEXT_LENGTH;
+
+                memset(state->text, 0, MAX_CONTROL_TEXT_LENGTH);
+                if (layout->texts[i] >= 0) strncpy(state->text, layout->strings + layout->texts[i], MAX_CONTROL_TEXT_LENGTH - 1);
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Draw layout controls (controls state is updated)
+// NOTE: Controls inside a closed window box are not drawn, gui is locked while any dropdown is in edit mode
+void DrawLayoutRuntime(GuiLayoutRuntime *layout)
+{
+    bool locked = false;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        if ((layout->controls[i].type == GUI_DROPDOWNBOX) && layout->states[i].editMode) locked = true;
+    }
+
+    if (locked) GuiLock();
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        // Skip controls inside a closed window box
+        if ((layout->parents[i] >= 0) && !layout->states[layout->parents[i]].active) continue;
+
+        GuiLayoutControl control = layout->controls[i];
+        GuiLayoutControlState *state = &layout->states[i];
+
+        // Skip closed window box (same as generated code)
+        if ((control.type == GUI_WINDOWBOX) && !state->active) continue;
+        Vector2 anchor = layout->anchors[control.anchorId];
+        Rectangle rec = { anchor.x + control.rec.x, anchor.y + control.rec.y, control.rec.width, control.rec.height };
+        const char *text = (layout->texts[i] >= 0)? (layout->strings + layout->texts[i]) : NULL;
+
+        switch (control.type)
+        {
+            case GUI_WINDOWBOX: state->active = !GuiWindowBox(rec, text); break;
+            case GUI_GROUPBOX: GuiGroupBox(rec, text); break;
+            case GUI_LINE: GuiLine(rec, text); break;
+            case GUI_PANEL: GuiPanel(rec, text); break;
+            case GUI_LABEL: GuiLabel(rec, text); break;
+            case GUI_BUTTON: state->active = GuiButton(rec, text); break;
+            case GUI_LABELBUTTON: state->active = GuiLabelButton(rec, text); break;
+            case GUI_CHECKBOX: GuiCheckBox(rec, text, &state->active); break;
+            case GUI_TOGGLE: GuiToggle(rec, text, &state->active); break;
+            case GUI_TOGGLEGROUP: GuiToggleGroup(rec, text, &state->value); break;
+            case GUI_COMBOBOX: GuiComboBox(rec, text, &state->value); break;
+            case GUI_DROPDOWNBOX: if (GuiDropdownBox(rec, text, &state->value, state->editMode)) state->editMode = !state->editMode; break;
+            case GUI_TEXTBOX:
+            case GUI_TEXTBOXMULTI:  // NOTE: GuiTextBoxMulti() is disabled on raygui 5.0-dev, regular text box used
+            {
+                if (GuiTextBox(rec, state->text, MAX_CONTROL_TEXT_LENGTH, state->editMode)) state->editMode = !state->editMode;
+            } break;
+            case GUI_VALUEBOX: if (GuiValueBox(rec, text, &state->value, 0, 100, state->editMode)) state->editMode = !state->editMode; break;
+            case GUI_SPINNER: if (GuiSpinner(rec, text, &state->value, 0, 100, state->editMode)) state->editMode = !state->editMode; break;
+            case GUI_SLIDER: GuiSlider(rec, text, NULL, &state->valuef, 0, 100); break;
+            case GUI_SLIDERBAR: GuiSliderBar(rec, text, NULL, &state->valuef, 0, 100); break;
+            case GUI_PROGRESSBAR: GuiProgressBar(rec, text, NULL, &state->valuef, 0, 1); break;
+            case GUI_STATUSBAR: GuiStatusBar(rec, text); break;
+            case GUI_SCROLLPANEL:
+            {
+                Rectangle bounds = { rec.x, rec.y, rec.width - state->boundsOffset.x, rec.height - state->boundsOffset.y };
+                GuiScrollPanel(bounds, text, rec, &state->scrollOffset, &state->scrollView);
+            } break;
+            case GUI_LISTVIEW: GuiListView(rec, text, &state->scrollIndex, &state->value); break;
+            case GUI_COLORPICKER: GuiColorPicker(rec, text, &state->color); break;
+            case GUI_DUMMYREC: GuiDummyRec(rec, text); break;
+            default: break;
+        }
+    }
+
+    if (locked) GuiUnlock();
+}
+
+// Get layout control index by name (-1 if not found)
+int GetLayoutRuntimeControl(const GuiLayoutRuntime *layout, const char *name)
+{
+    int index = -1;
+
+    for (int i = 0; i < layout->controlCount; i++)
+    {
+        if (strcmp(layout->strings + layout->names[i], name) == 0)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    return index;
+}
+
+// Get layout control state by name (NULL if not found)
+GuiLayoutControlState *GetLayoutRuntimeControlState(GuiLayoutRuntime *layout, const char *name)
+{
+    int index = GetLayoutRuntimeControl(layout, name);
+
+    return (index >= 0)? &layout->states[index] : NULL;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load layout records from text file data
+// NOTE: Lines are tokenized in place (null-terminated), records reference text data
+static void LoadLayoutRuntimeText(LayoutRuntimeRecords *records, char *text)
+{
+    char *line = text;
+
+    while ((line != NULL) && (line[0] != '\0'))
+    {
+        char *next = strchr(line, '\n');
+        if (next != NULL) *next++ = '\0';
+
+        // Trim trailing carriage return (CRLF line endings)
+        int lineLength = (int)strlen(line);
+        while ((lineLength > 0) && (line[lineLength - 1] == '\r')) line[--lineLength] = '\0';
+
+        char *ptr = line + 1;
+
+        switch (line[0])
+        {
+            case 'r':
+            {
+                records->refWindow.x = strtof(ptr, &ptr);
+                records->refWindow.y = strtof(ptr, &ptr);
+                records->refWindow.width = strtof(ptr, &ptr);
+                records->refWindow.height = strtof(ptr, &ptr);
+            } break;
+            case 'a':
+            {
+                const char *name = NULL;
+                int nameLength = 0;
+
+                int id = (int)strtol(ptr, &ptr, 10);
+
+                if (id > 0)
+                {
+                    ptr = (char *)ScanRuntimeWord(ptr, &name, &nameLength);
+
+                    Vector2 position = { 0 };
+                    position.x = (float)strtol(ptr, &ptr, 10);
+                    position.y = (float)strtol(ptr, &ptr, 10);
+
+                    SetLayoutRuntimeAnchor(records, id, position);
+                }
+            } break;
+            case 'c':
+            {
+                LayoutRuntimeRecord *record = AddLayoutRuntimeRecord(records);
+
+                strtol(ptr, &ptr, 10);      // Skip control id
+                record->control.type = (int)strtol(ptr, &ptr, 10);
+                ptr = (char *)ScanRuntimeWord(ptr, &record->name, &record->nameLength);
+                record->control.rec.x = strtof(ptr, &ptr);
+                record->control.rec.y = strtof(ptr, &ptr);
+                record->control.rec.width = strtof(ptr, &ptr);
+                record->control.rec.height = strtof(ptr, &ptr);
+                record->control.anchorId = (int)strtol(ptr, &ptr, 10);
+
+                // Remaining line is control text
+                while ((*ptr == ' ') || (*ptr == '\t')) ptr++;
+                record->text = ptr;
+                record->textLength = (int)strlen(ptr);
+            } break;
+            default: break;
+        }
+
+        line = next;
+    }
+}
+
+// Load layout records from binary file data
+// NOTE: Records are fixed size, names and texts reference binary data
+static void LoadLayoutRuntimeBinary(LayoutRuntimeRecords *records, const unsigned char *data, int size)
+{
+    const unsigned char *ptr = data;
+    const unsigned char *end = data + size;
+
+    short version = 0;
+    int count = 0;
+    int value[4] = { 0 };
+
+    if (size < (8 + 4*4 + 4)) return;
+
+    memcpy(&version, ptr + 4, sizeof(short));
+    ptr += 8;   // Skip signature, version and reserved
+
+    if (version != RGL_FILE_VERSION_BINARY) return;
+
+    // Read reference window
+    memcpy(value, ptr, 4*sizeof(int));
+    ptr += 4*sizeof(int);
+    records->refWindow = (Rectangle){ (float)value[0], (float)value[1], (float)value[2], (float)value[3] };
+
+    // Read anchors data
+    memcpy(&count, ptr, sizeof(int));
+    ptr += sizeof(int);
+
+    if (count > (int)((end - ptr)/RGL_BINARY_ANCHOR_SIZE)) count = (int)((end - ptr)/RGL_BINARY_ANCHOR_SIZE);
+
+    for (int i = 0; i < count; i++, ptr += RGL_BINARY_ANCHOR_SIZE)
+    {
+        int id = 0;
+        memcpy(&id, ptr, sizeof(int));
+        memcpy(value, ptr + 4 + RGL_BINARY_NAME_SIZE, 2*sizeof(int));
+
+        if (id > 0) SetLayoutRuntimeAnchor(records, id, (Vector2){ (float)value[0], (float)value[1] });
+    }
+
+    // Read controls data
+    if ((end - ptr) < (int)sizeof(int)) return;
+
+    memcpy(&count, ptr, sizeof(int));
+    ptr += sizeof(int);
+
+    if (count > (int)((end - ptr)/RGL_BINARY_CONTROL_SIZE)) count = (int)((end - ptr)/RGL_BINARY_CONTROL_SIZE);
+
+    for (int i = 0; i < count; i++, ptr += RGL_BINARY_CONTROL_SIZE)
+    {
+        LayoutRuntimeRecord *record = AddLayoutRuntimeRecord(records);
+
+        memcpy(&record->control.type, ptr + 4, sizeof(int));
+        memcpy(value, ptr + 8 + RGL_BINARY_NAME_SIZE, 4*sizeof(int));
+        memcpy(&record->control.anchorId, ptr + 8 + RGL_BINARY_NAME_SIZE + 4*4, sizeof(int));
+        record->control.rec = (Rectangle){ (float)value[0], (float)value[1], (float)value[2], (float)value[3] };
+
+        record->name = (const char *)ptr + 8;
+        record->text = (const char *)ptr + 8 + RGL_BINARY_NAME_SIZE + 4*4 + 4;
+        while ((record->nameLength < (RGL_BINARY_NAME_SIZE - 1)) && (record->name[record->nameLength] != '\0')) record->nameLength++;
+        while ((record->textLength < (RGL_BINARY_TEXT_SIZE - 1)) && (record->text[record->textLength] != '\0')) record->textLength++;
+    }
+}
+
+// Add control record, records grow on demand
+static LayoutRuntimeRecord *AddLayoutRuntimeRecord(LayoutRuntimeRecords *records)
+{
+    if (records->count >= records->capacity)
+    {
+        int capacity = (records->capacity > 0)? records->capacity*2 : GUI_CONTROLS_INITIAL_CAPACITY;
+        records->records = (LayoutRuntimeRecord *)RL_REALLOC(records->records, capacity*sizeof(LayoutRuntimeRecord));
+        records->capacity = capacity;
+    }
+
+    LayoutRuntimeRecord *record = &records->records[records->count];
+    memset(record, 0, sizeof(LayoutRuntimeRecord));
+    records->count++;
+
+    return record;
+}
+
+// Set anchor position, anchors grow on demand (anchor id as index)
+static void SetLayoutRuntimeAnchor(LayoutRuntimeRecords *records, int id, Vector2 position)
+{
+    if (id >= records->anchorCount)
+    {
+        records->anchors = (Vector2 *)RL_REALLOC(records->anchors, (id + 1)*sizeof(Vector2));
+        memset(records->anchors + records->anchorCount, 0, (id + 1 - records->anchorCount)*sizeof(Vector2));
+        records->anchorCount = id + 1;
+    }
+
+    records->anchors[id] = position;
+}
+
+// Build layout runtime from records
+// NOTE: Controls are sorted in drawing order, same order used on code generation
+static GuiLayoutRuntime BuildLayoutRuntime(const LayoutRuntimeRecords *records)
+{
+    GuiLayoutRuntime layout = { 0 };
+
+    int count = records->count;
+    int anchorCount = (records->anchorCount > 0)? records->anchorCount : 1;
+
+    layout.controlCount = count;
+    layout.anchorCount = anchorCount;
+    layout.refWindow = records->refWindow;
+    layout.controls = (GuiLayoutControl *)RL_CALLOC(count + 1, sizeof(GuiLayoutControl));
+    layout.states = (GuiLayoutControlState *)RL_CALLOC(count + 1, sizeof(GuiLayoutControlState));
+    layout.parents = (int *)RL_CALLOC(count + 1, sizeof(int));
+    layout.names = (int *)RL_CALLOC(count + 1, sizeof(int));
+    layout.texts = (int *)RL_CALLOC(count + 1, sizeof(int));
+    layout.anchors = (Vector2 *)RL_CALLOC(anchorCount, sizeof(Vector2));
+
+    // Anchors position, relative to reference window (anchor 0)
+    // NOTE: Layout files already store anchors with refWindow offset subtracted (see SaveLayout()),
+    // same positions emitted by code generation (GetCodeAnchor()), so they must not be offset again
+    for (int i = 1; i < records->anchorCount; i++) layout.anchors[i] = records->anchors[i];
+
+    // Get controls drawing order: bucket controls by anchor and type class (regular, dropdown), keeping file order
+    // NOTE: Controls linked to an anchor are drawn inside the first window box linked to same anchor
+    int *order = (int *)RL_CALLOC(count + 1, sizeof(int));
+    int *parent = (int *)RL_CALLOC(count + 1, sizeof(int));
+    int *bucketStart = (int *)RL_CALLOC(anchorCount*2 + 1, sizeof(int));
+    int *bucketControls = (int *)RL_CALLOC(count + 1, sizeof(int));
+    int *anchorWindow = (int *)RL_CALLOC(anchorCount, sizeof(int));      // First window on anchor (index + 1)
+    GuiLayoutControl *controls = (GuiLayoutControl *)RL_CALLOC(count + 1, sizeof(GuiLayoutControl));     // Records controls (local copy)
+
+    for (int i = 0; i < count; i++)
+    {
+        GuiLayoutControl control = records->records[i].control;
+
+        // NOTE: Controls linked to an undefined anchor are linked to reference window, input records are not modified
+        if ((control.anchorId < 0) || (control.anchorId >= anchorCount)) control.anchorId = 0;
+        controls[i] = control;
+
+        if (control.type == GUI_WINDOWBOX)
+        {
+            if (anchorWindow[control.anchorId] == 0) anchorWindow[control.anchorId] = i + 1;
+        }
+        else bucketStart[control.anchorId*2 + ((control.type == GUI_DROPDOWNBOX)? 1 : 0) + 1]++;
+    }
+
+    for (int k = 0; k < anchorCount*2; k++) bucketStart[k + 1] += bucketStart[k];
+
+    int *bucketNext = (int *)RL_CALLOC(anchorCount*2, sizeof(int));
+    memcpy(bucketNext, bucketStart, anchorCount*2*sizeof(int));
+
+    for (int i = 0; i < count; i++)
+    {
+        GuiLayoutControl control = controls[i];
+        if (control.type != GUI_WINDOWBOX) bucketControls[bucketNext[control.anchorId*2 + ((control.type == GUI_DROPDOWNBOX)? 1 : 0)]++] = i;
+    }
+
+    int position = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int anchorId = controls[i].anchorId;
+
+        if (controls[i].type == GUI_WINDOWBOX)
+        {
+            int window = position;
+
+            order[position] = i;
+            parent[position++] = -1;
+
+            if (anchorWindow[anchorId] == (i + 1))
+            {
+                for (int k = bucketStart[anchorId*2]; k < bucketStart[anchorId*2 + 2]; k++)
+                {
+                    order[position] = bucketControls[k];
+                    parent[position++] = window;
+                }
+            }
+        }
+    }
+
+    for (int pass = 0; pass < 2; pass++)    // Regular controls first, then dropdowns
+    {
+        for (int i = 0; i < count; i++)
+        {
+            GuiLayoutControl control = controls[i];
+
+            if ((control.type != GUI_WINDOWBOX) && (((control.type == GUI_DROPDOWNBOX)? 1 : 0) == pass) && (anchorWindow[control.anchorId] == 0))
+            {
+                order[position] = i;
+                parent[position++] = -1;
+            }
+        }
+    }
+
+    // Copy controls data in drawing order, names and texts copied once into strings data
+    int stringsSize = 0;
+    for (int i = 0; i < count; i++) stringsSize += records->records[i].nameLength + records->records[i].textLength + 2;
+
+    layout.strings = (char *)RL_CALLOC(stringsSize + 1, 1);
+
+    int stringsOffset = 0;
+    int textCount = 0;
+
+    for (int k = 0; k < count; k++)
+    {
+        const LayoutRuntimeRecord *record = &records->records[order[k]];
+        int nameLength = (record->nameLength < MAX_CONTROL_NAME_LENGTH)? record->nameLength : MAX_CONTROL_NAME_LENGTH - 1;
+        int textLength = (record->textLength < MAX_CONTROL_TEXT_LENGTH)? record->textLength : MAX_CONTROL_TEXT_LENGTH - 1;
+
+        layout.controls[k] = controls[order[k]];
+        layout.parents[k] = parent[k];
+
+        layout.names[k] = stringsOffset;
+        memcpy(layout.strings + stringsOffset, record->name, nameLength);
+        stringsOffset += nameLength + 1;
+
+        if (textLength > 0)
+        {
+            layout.texts[k] = stringsOffset;
+            memcpy(layout.strings + stringsOffset, record->text, textLength);
+            stringsOffset += textLength + 1;
+        }
+        else layout.texts[k] = -1;
+
+        if ((record->control.type == GUI_TEXTBOX) || (record->control.type == GUI_TEXTBOXMULTI)) textCount++;
+    }
+
+    layout.editTexts = (char *)RL_CALLOC(textCount*MAX_CONTROL_TEXT_LENGTH + 1, 1);
+
+    ResetLayoutRuntimeState(&layout);
+
+    RL_FREE(order);
+    RL_FREE(parent);
+    RL_FREE(bucketStart);
+    RL_FREE(bucketNext);
+    RL_FREE(bucketControls);
+    RL_FREE(anchorWindow);
+    RL_FREE(controls);
+
+    return layout;
+}
+
+// Scan word (no blanks) from null-terminated line, returns word position and length (not copied)
+static const char *ScanRuntimeWord(const char *ptr, const char **word, int *length)
+{
+    while ((*ptr == ' ') || (*ptr == '\t')) ptr++;
+
+    *word = ptr;
+    while ((*ptr != '\0') && (*ptr != ' ') && (*ptr != '\t')) ptr++;
+    *length = (int)(ptr - *word);
+
+    return ptr;
+}
+
+#endif // RGUILAYOUT_RUNTIME_IMPLEMENTATION